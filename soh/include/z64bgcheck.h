@@ -152,6 +152,20 @@ typedef struct {
     /* 0x140C */ s32 vtxListMax;
 } DynaCollisionContext; // size = 0x1410
 
+// Float copies of the scene's static collision, built once per scene so the static floor, wall, ceiling and sphere
+// checks don't convert vertices on every test. Each field is its own array indexed by poly id, vtx holds 3 per poly.
+typedef struct {
+    s32 numPolys;
+    f32* minX;
+    f32* maxX;
+    f32* minY;
+    f32* maxY;
+    f32* minZ;
+    f32* maxZ;
+    Vec3f* normal;
+    Vec3f* vtx;
+} StaticPolyCache;
+
 typedef struct CollisionContext {
     /* 0x00 */ CollisionHeader* colHeader; // scene's static collision
     /* 0x04 */ Vec3f minBounds;            // minimum coordinates of collision bounding box
@@ -163,6 +177,7 @@ typedef struct CollisionContext {
     /* 0x44 */ SSNodeList polyNodes;
     /* 0x50 */ DynaCollisionContext dyna;
     /* 0x1460 */ u32 memSize; // Size of all allocated memory plus CollisionContext
+    StaticPolyCache* polyCache; // NULL if the cache couldn't be allocated
 } CollisionContext; // size = 0x1464
 
 typedef struct {
@@ -1,10 +1,19 @@
 #ifndef Z_COLLISION_CHECK_H
 #define Z_COLLISION_CHECK_H
 
+// Builds for modded content that spawns a lot of actors can raise these, e.g. -DCOLLISION_CHECK_AC_MAX=120
+#ifndef COLLISION_CHECK_AT_MAX
 #define COLLISION_CHECK_AT_MAX 50
+#endif
+#ifndef COLLISION_CHECK_AC_MAX
 #define COLLISION_CHECK_AC_MAX 60
+#endif
+#ifndef COLLISION_CHECK_OC_MAX
 #define COLLISION_CHECK_OC_MAX 50
+#endif
+#ifndef COLLISION_CHECK_OC_LINE_MAX
 #define COLLISION_CHECK_OC_LINE_MAX 3
+#endif
 
 // From z64.h
 struct Actor;
@@ -329,6 +329,10 @@ AudioCollection::AudioCollection() {
         //SEQUENCE_MAP_ENTRY(NA_SE_VO_DUMMY_0x89_YOBI,     "NA_SE_VO_DUMMY_0x89_YOBI",            "NA_SE_VO_DUMMY_0x89_YOBI",       SEQ_VOICE, true, false), // ..
     };
 
+    replacementTable = std::make_unique<std::atomic<uint16_t>[]>(UINT16_MAX + 1);
+    for (uint32_t seqId = 0; seqId <= UINT16_MAX; seqId++) {
+        replacementTable[seqId].store(seqId, std::memory_order_relaxed);
+    }
 }
 
 std::string AudioCollection::GetCvarKey(std::string sfxKey) {
@@ -361,7 +365,7 @@ void AudioCollection::AddToCollection(char* otrPath, uint16_t seqNum) {
     sequenceMap.emplace(seqNum, info);
 }
 
-uint16_t AudioCollection::GetReplacementSequence(uint16_t seqId) {
+uint16_t AudioCollection::ReadReplacementSequence(uint16_t seqId) {
     // if Hyrule Field Morning is about to play, but Hyrule Field is swapped, get the replacement sequence
     // for Hyrule Field instead. Otherwise, leave it alone, so that without any sfx editor modifications we will
     // play the normal track as usual.
@@ -384,6 +388,17 @@ uint16_t AudioCollection::GetReplacementSequence(uint16_t seqId) {
     return static_cast<uint16_t>(replacementSeq);
 }
 
+uint16_t AudioCollection::GetReplacementSequence(uint16_t seqId) {
+    return replacementTable[seqId].load(std::memory_order_relaxed);
+}
+
+void AudioCollection::UpdateReplacementTable() {
+    // Only sequences in the collection can have a replacement, everything else keeps mapping to itself
+    for (const auto& [seqId, seqInfo] : sequenceMap) {
+        replacementTable[seqId].store(ReadReplacementSequence(seqId), std::memory_order_relaxed);
+    }
+}
+
 void AudioCollection::RemoveFromShufflePool(SequenceInfo* seqInfo) {
     const std::string cvarKey = std::string(CVAR_AUDIO("Excluded.")) + seqInfo->sfxKey;
     excludedSequences.insert(seqInfo);
@@ -447,3 +462,7 @@ extern "C" bool AudioCollection_HasSequenceNum(uint16_t seqId) {
 extern "C" size_t AudioCollection_SequenceMapSize() {
     return AudioCollection::Instance->SequenceMapSize();
 }
+
+extern "C" void AudioCollection_UpdateReplacementTable() {
+    AudioCollection::Instance->UpdateReplacementTable();
+}
@@ -1,6 +1,8 @@
 #pragma once
 #ifdef __cplusplus
+#include <atomic>
 #include <map>
+#include <memory>
 #include <string>
 #include <set>
 #include <cstdint>
@@ -45,6 +47,11 @@ class AudioCollection {
         std::set<SequenceInfo*, compareSequenceLabel> excludedSequences;
         bool shufflePoolInitialized = false;
 
+        // Replacement for every possible sequence id, read by the audio thread without locking. Only rewritten by
+        // UpdateReplacementTable, after the audio editor changes its CVars and on every scene init
+        std::unique_ptr<std::atomic<uint16_t>[]> replacementTable;
+        uint16_t ReadReplacementSequence(uint16_t seqId);
+
     public:
         static AudioCollection* Instance;
         AudioCollection();
@@ -61,6 +68,7 @@ class AudioCollection {
         void RemoveFromShufflePool(SequenceInfo*);
         void AddToCollection(char* otrPath, uint16_t seqNum);
         uint16_t GetReplacementSequence(uint16_t seqId);
+        void UpdateReplacementTable();
         void InitializeShufflePool();
         const char* GetSequenceName(uint16_t seqId);
         bool HasSequenceNum(uint16_t seqId);
@@ -73,4 +81,5 @@ void AudioCollection_AddToCollection(char *otrPath, uint16_t seqNum);
 const char* AudioCollection_GetSequenceName(uint16_t seqId);
 bool AudioCollection_HasSequenceNum(uint16_t seqId);
 size_t AudioCollection_SequenceMapSize();
+void AudioCollection_UpdateReplacementTable();
 #endif
\ No newline at end of file
@@ -78,7 +78,8 @@ void UpdateCurrentBGM(u16 seqKey, SeqType seqType) {
     }
 }
 
-void RandomizeGroup(SeqType type) {
+// updateTable is false when randomizing several groups in a row, so the caller rebuilds the replacement table once
+void RandomizeGroup(SeqType type, bool updateTable = true) {
     std::vector<u16> values;
 
     // An empty IncludedSequences set means that the AudioEditor window has never been drawn
@@ -112,9 +113,12 @@ void RandomizeGroup(SeqType type) {
             values.pop_back();
         }
     }
+    if (updateTable) {
+        AudioCollection::Instance->UpdateReplacementTable();
+    }
 }
 
-void ResetGroup(const std::map<u16, SequenceInfo>& map, SeqType type) {
+void ResetGroup(const std::map<u16, SequenceInfo>& map, SeqType type, bool updateTable = true) {
     for (const auto& [defaultValue, seqData] : map) {
         if (seqData.category == type) {
             // Only save authentic sequence CVars
@@ -128,6 +132,9 @@ void ResetGroup(const std::map<u16, SequenceInfo>& map, SeqType type) {
             }
         }
     }
+    if (updateTable) {
+        AudioCollection::Instance->UpdateReplacementTable();
+    }
 }
 
 void LockGroup(const std::map<u16, SequenceInfo>& map, SeqType type) {
@@ -282,6 +289,7 @@ void Draw_SfxTab(const std::string& tabId, SeqType type) {
 
                 if (ImGui::Selectable(seqData.label.c_str())) {
                     CVarSetInteger(cvarKey.c_str(), value);
+                    AudioCollection::Instance->UpdateReplacementTable();
                     Ship::Context::GetInstance()->GetWindow()->GetGui()->SaveConsoleVariablesOnNextTick();
                     UpdateCurrentBGM(defaultValue, type);
                 }
@@ -302,6 +310,7 @@ void Draw_SfxTab(const std::string& tabId, SeqType type) {
         if (ImGui::Button(resetButton.c_str())) {
             CVarClear(cvarKey.c_str());
             CVarClear(cvarLockKey.c_str());
+            AudioCollection::Instance->UpdateReplacementTable();
             Ship::Context::GetInstance()->GetWindow()->GetGui()->SaveConsoleVariablesOnNextTick();
             UpdateCurrentBGM(defaultValue, seqData.category);
         }
@@ -323,6 +332,7 @@ void Draw_SfxTab(const std::string& tabId, SeqType type) {
                 if (locked) {
                     CVarClear(cvarLockKey.c_str());
                 }
+                AudioCollection::Instance->UpdateReplacementTable();
                 Ship::Context::GetInstance()->GetWindow()->GetGui()->SaveConsoleVariablesOnNextTick();
                 UpdateCurrentBGM(defaultValue, type);
             } 
@@ -414,6 +424,9 @@ void AudioEditorRegisterOnSceneInitHook() {
     GameInteractor::Instance->RegisterGameHook<GameInteractor::OnSceneInit>([](int16_t sceneNum) {
         if (CVarGetInteger(CVAR_AUDIO("RandomizeAllOnNewScene"), 0)) {
             AudioEditor_RandomizeAll();
+        } else {
+            // Picks up replacement CVars changed outside the editor, such as from the console
+            AudioCollection::Instance->UpdateReplacementTable();
         }
     });
 }
@@ -701,8 +714,9 @@ std::vector<SeqType> allTypes = { SEQ_BGM_WORLD, SEQ_BGM_EVENT, SEQ_BGM_BATTLE,
 
 void AudioEditor_RandomizeAll() {
     for (auto type : allTypes) {
-        RandomizeGroup(type);
+        RandomizeGroup(type, false);
     }
+    AudioCollection::Instance->UpdateReplacementTable();
 
     Ship::Context::GetInstance()->GetWindow()->GetGui()->SaveConsoleVariablesOnNextTick();
     ReplayCurrentBGM();
@@ -717,8 +731,9 @@ void AudioEditor_RandomizeGroup(SeqType group) {
 
 void AudioEditor_ResetAll() {
     for (auto type : allTypes) {
-        ResetGroup(AudioCollection::Instance->GetAllSequences(), type);
+        ResetGroup(AudioCollection::Instance->GetAllSequences(), type, false);
     }
+    AudioCollection::Instance->UpdateReplacementTable();
 
     Ship::Context::GetInstance()->GetWindow()->GetGui()->SaveConsoleVariablesOnNextTick();
     ReplayCurrentBGM();
@@ -89,6 +89,8 @@ typedef struct {
     bool supportsAlpha;
     bool supportsRainbow;
     bool advancedOption;
+    // Set by CosmeticsUpdateTick when the rainbow moved this option to a new color, so only its patches are rewritten
+    bool rainbowColorChanged;
 } CosmeticOption;
 
 #define COSMETIC_OPTION(id, label, group, defaultColor, supportsAlpha, supportsRainbow, advancedOption) \
@@ -419,40 +421,53 @@ int hue = 0;
 void CosmeticsUpdateTick() {
     int index = 0;
     float rainbowSpeed = CVarGetFloat(CVAR_COSMETIC("RainbowSpeed"), 0.6f);
+    bool rainbowSync = CVarGetInteger(CVAR_COSMETIC("RainbowSync"), 0);
+    float frequency = 2 * M_PI / (360 * rainbowSpeed);
+    // Synced options all land on the same hue, so the color is only worked out again when the hue moves
+    int rainbowHue = -1;
+    Color_RGBA8 rainbowColor = { 0, 0, 0, 255 };
+    bool anyColorChanged = false;
     for (auto& [id, cosmeticOption] : cosmeticOptions) {
+        cosmeticOption.rainbowColorChanged = false;
         if (cosmeticOption.supportsRainbow && CVarGetInteger(cosmeticOption.rainbowCvar, 0)) {
-            float frequency = 2 * M_PI / (360 * rainbowSpeed);
-            Color_RGBA8 newColor;
-            newColor.r = sin(frequency * (hue + index) + 0) * 127 + 128;
-            newColor.g = sin(frequency * (hue + index) + (2 * M_PI / 3)) * 127 + 128;
-            newColor.b = sin(frequency * (hue + index) + (4 * M_PI / 3)) * 127 + 128;
+            if (rainbowHue != hue + index) {
+                rainbowHue = hue + index;
+                rainbowColor.r = sin(frequency * rainbowHue + 0) * 127 + 128;
+                rainbowColor.g = sin(frequency * rainbowHue + (2 * M_PI / 3)) * 127 + 128;
+                rainbowColor.b = sin(frequency * rainbowHue + (4 * M_PI / 3)) * 127 + 128;
+            }
+            Color_RGBA8 newColor = rainbowColor;
             newColor.a = 255;
             // For alpha supported options, retain the last set alpha instead of overwriting
             if (cosmeticOption.supportsAlpha) {
                 newColor.a = cosmeticOption.currentColor.w * 255;
             }
 
-            cosmeticOption.currentColor.x = newColor.r / 255.0;
-            cosmeticOption.currentColor.y = newColor.g / 255.0;
-            cosmeticOption.currentColor.z = newColor.b / 255.0;
-            cosmeticOption.currentColor.w = newColor.a / 255.0;
-
-            CVarSetColor(cosmeticOption.cvar, newColor);
+            ImVec4 newCurrentColor = ImVec4(newColor.r / 255.0, newColor.g / 255.0, newColor.b / 255.0, newColor.a / 255.0);
+            if (newCurrentColor.x != cosmeticOption.currentColor.x || newCurrentColor.y != cosmeticOption.currentColor.y ||
+                newCurrentColor.z != cosmeticOption.currentColor.z || newCurrentColor.w != cosmeticOption.currentColor.w) {
+                cosmeticOption.currentColor = newCurrentColor;
+                cosmeticOption.rainbowColorChanged = true;
+                anyColorChanged = true;
+                CVarSetColor(cosmeticOption.cvar, newColor);
+            }
         }
         // If we don't want the rainbow color on items to be synced, offset the index for each item in the loop.
         // Technically this would work if you replaced "60" with 1 but the hue would be so close it's 
         // indistinguishable, 60 gives us a big enough gap to notice the difference.
-        if (!CVarGetInteger(CVAR_COSMETIC("RainbowSync"), 0)) {
+        if (!rainbowSync) {
             index+= (60 * rainbowSpeed);
         }
     }
-    ApplyOrResetCustomGfxPatches(false);
+    if (anyColorChanged) {
+        ApplyOrResetCustomGfxPatches(false);
+    }
     hue++;
     if (hue >= (360 * rainbowSpeed)) hue = 0;
 }
 
 /* 
-    This is called every time a color is changed in the UI, and every frame to update colors that have rainbow mode enabled
+    This is called every time a color is changed in the UI, and on frames where a rainbow option changed color to update only those
     The columns/arguments for PATCH_GFX are as follows:
     1. Display List: This should be a valid display list pointer, if you have errors listing one here make sure to include the appropriate header file up top
     2. Patch Name: Each of these MUST be unique, used for restoring the original DList command, if these are not unique bugs WILL happen
@@ -462,7 +477,7 @@ void CosmeticsUpdateTick() {
 */
 void ApplyOrResetCustomGfxPatches(bool manualChange) {
     static CosmeticOption& linkGoronTunic = cosmeticOptions.at("Link.GoronTunic");
-    if (manualChange || CVarGetInteger(linkGoronTunic.rainbowCvar, 0)) {
+    if (manualChange || linkGoronTunic.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {linkGoronTunic.defaultColor.x, linkGoronTunic.defaultColor.y, linkGoronTunic.defaultColor.z, linkGoronTunic.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(linkGoronTunic.cvar, defaultColor);
         PATCH_GFX(gGiGoronTunicColorDL,                           "Link_GoronTunic1",         linkGoronTunic.changedCvar,           3, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
@@ -472,7 +487,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
 
     static CosmeticOption& linkZoraTunic = cosmeticOptions.at("Link.ZoraTunic");
-    if (manualChange || CVarGetInteger(linkZoraTunic.rainbowCvar, 0)) {
+    if (manualChange || linkZoraTunic.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {linkZoraTunic.defaultColor.x, linkZoraTunic.defaultColor.y, linkZoraTunic.defaultColor.z, linkZoraTunic.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(linkZoraTunic.cvar, defaultColor);
         PATCH_GFX(gGiZoraTunicColorDL,                            "Link_ZoraTunic1",          linkZoraTunic.changedCvar,            3, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
@@ -482,7 +497,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
 
     static CosmeticOption& linkHair = cosmeticOptions.at("Link.Hair");
-    if (manualChange || CVarGetInteger(linkHair.rainbowCvar, 0)) {
+    if (manualChange || linkHair.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {linkHair.defaultColor.x, linkHair.defaultColor.y, linkHair.defaultColor.z, linkHair.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(linkHair.cvar, defaultColor);
         PATCH_GFX(gLinkChildHeadNearDL,                           "Link_Hair1",               linkHair.changedCvar,                10, gsDPSetGrayscaleColor(color.r, color.g, color.b, 255));
@@ -505,7 +520,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
 
     static CosmeticOption& linkLinen = cosmeticOptions.at("Link.Linen");
-    if (manualChange || CVarGetInteger(linkLinen.rainbowCvar, 0)) {
+    if (manualChange || linkLinen.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {linkLinen.defaultColor.x, linkLinen.defaultColor.y, linkLinen.defaultColor.z, linkLinen.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(linkLinen.cvar, defaultColor);
         PATCH_GFX(gLinkAdultLeftArmNearDL,                        "Link_Linen1",              linkLinen.changedCvar,               30, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
@@ -547,7 +562,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
 
     static CosmeticOption& linkBoots = cosmeticOptions.at("Link.Boots");
-    if (manualChange || CVarGetInteger(linkBoots.rainbowCvar, 0)) {
+    if (manualChange || linkBoots.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {linkBoots.defaultColor.x, linkBoots.defaultColor.y, linkBoots.defaultColor.z, linkBoots.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(linkBoots.cvar, defaultColor);
         PATCH_GFX(gLinkChildRightShinNearDL,                      "Link_Boots1",              linkBoots.changedCvar,               10, gsDPSetGrayscaleColor(color.r, color.g, color.b, 255));
@@ -584,7 +599,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
 
     static CosmeticOption& mirrorShieldBody = cosmeticOptions.at("MirrorShield.Body");
-    if (manualChange || CVarGetInteger(mirrorShieldBody.rainbowCvar, 0)) {
+    if (manualChange || mirrorShieldBody.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {mirrorShieldBody.defaultColor.x, mirrorShieldBody.defaultColor.y, mirrorShieldBody.defaultColor.z, mirrorShieldBody.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(mirrorShieldBody.cvar, defaultColor);
         PATCH_GFX(gGiMirrorShieldDL,                              "MirrorShield_Body1",       mirrorShieldBody.changedCvar,         5, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
@@ -597,7 +612,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
         PATCH_GFX(gLinkAdultRightHandHoldingMirrorShieldFarDL,    "MirrorShield_Body8",       mirrorShieldBody.changedCvar,        95, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
     }
     static CosmeticOption& mirrorShieldMirror = cosmeticOptions.at("MirrorShield.Mirror");
-    if (manualChange || CVarGetInteger(mirrorShieldMirror.rainbowCvar, 0)) {
+    if (manualChange || mirrorShieldMirror.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {mirrorShieldMirror.defaultColor.x, mirrorShieldMirror.defaultColor.y, mirrorShieldMirror.defaultColor.z, mirrorShieldMirror.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(mirrorShieldMirror.cvar, defaultColor);
         PATCH_GFX(gGiMirrorShieldDL,                              "MirrorShield_Mirror1",     mirrorShieldMirror.changedCvar,      47, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
@@ -610,7 +625,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
         PATCH_GFX(gLinkAdultRightHandHoldingMirrorShieldFarDL,    "MirrorShield_Mirror8",     mirrorShieldMirror.changedCvar,     111, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
     }
     static CosmeticOption& mirrorShieldEmblem = cosmeticOptions.at("MirrorShield.Emblem");
-    if (manualChange || CVarGetInteger(mirrorShieldEmblem.rainbowCvar, 0)) {
+    if (manualChange || mirrorShieldEmblem.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {mirrorShieldEmblem.defaultColor.x, mirrorShieldEmblem.defaultColor.y, mirrorShieldEmblem.defaultColor.z, mirrorShieldEmblem.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(mirrorShieldEmblem.cvar, defaultColor);
         PATCH_GFX(gGiMirrorShieldSymbolDL,                        "MirrorShield_Emblem1",     mirrorShieldEmblem.changedCvar,       5, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 140));
@@ -624,7 +639,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
 
     static CosmeticOption& swordsKokiriBlade = cosmeticOptions.at("Swords.KokiriBlade");
-    if (manualChange || CVarGetInteger(swordsKokiriBlade.rainbowCvar, 0)) {
+    if (manualChange || swordsKokiriBlade.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {swordsKokiriBlade.defaultColor.x, swordsKokiriBlade.defaultColor.y, swordsKokiriBlade.defaultColor.z, swordsKokiriBlade.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(swordsKokiriBlade.cvar, defaultColor);
         PATCH_GFX(gLinkChildLeftFistAndKokiriSwordNearDL,         "Swords_KokiriBlade1",      swordsKokiriBlade.changedCvar,       79, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
@@ -633,7 +648,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
         PATCH_GFX(gGiKokiriSwordDL,                               "Swords_KokiriBlade4",      swordsKokiriBlade.changedCvar,        6, gsDPSetEnvColor(color.r / 4, color.g / 4, color.b / 4, 255));
     }
     // static CosmeticOption& swordsKokiriHilt = cosmeticOptions.at("Swords.KokiriHilt");
-    // if (manualChange || CVarGetInteger(swordsKokiriHilt.rainbowCvar, 0)) {
+    // if (manualChange || swordsKokiriHilt.rainbowColorChanged) {
     //     static Color_RGBA8 defaultColor = {swordsKokiriHilt.defaultColor.x, swordsKokiriHilt.defaultColor.y, swordsKokiriHilt.defaultColor.z, swordsKokiriHilt.defaultColor.w};
     //     Color_RGBA8 color = CVarGetColor(swordsKokiriHilt.cvar, defaultColor);
     //     PATCH_GFX(gLinkChildLeftFistAndKokiriSwordNearDL,         "Swords_KokiriHilt1",       swordsKokiriHilt.changedCvar,         4, gsDPSetGrayscaleColor(color.r, color.g, color.b, 255));
@@ -674,7 +689,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     //     }
     // }
     static CosmeticOption& swordsMasterBlade = cosmeticOptions.at("Swords.MasterBlade");
-    if (manualChange || CVarGetInteger(swordsMasterBlade.rainbowCvar, 0)) {
+    if (manualChange || swordsMasterBlade.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {swordsMasterBlade.defaultColor.x, swordsMasterBlade.defaultColor.y, swordsMasterBlade.defaultColor.z, swordsMasterBlade.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(swordsMasterBlade.cvar, defaultColor);
         PATCH_GFX(gLinkAdultLeftHandHoldingMasterSwordFarDL,      "Swords_MasterBlade1",      swordsMasterBlade.changedCvar,       60, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
@@ -685,7 +700,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
         PATCH_GFX(gGanonMasterSwordDL,                            "Swords_MasterBlade6",      swordsMasterBlade.changedCvar,       14, gsDPSetEnvColor(color.r / 2, color.g / 2, color.b / 2, 255));
     }
     // static CosmeticOption& swordsMasterHilt = cosmeticOptions.at("Swords.MasterHilt");
-    // if (manualChange || CVarGetInteger(swordsMasterHilt.rainbowCvar, 0)) {
+    // if (manualChange || swordsMasterHilt.rainbowColorChanged) {
     //     static Color_RGBA8 defaultColor = {swordsMasterHilt.defaultColor.x, swordsMasterHilt.defaultColor.y, swordsMasterHilt.defaultColor.z, swordsMasterHilt.defaultColor.w};
     //     Color_RGBA8 color = CVarGetColor(swordsMasterHilt.cvar, defaultColor);
     //     PATCH_GFX(gLinkAdultLeftHandHoldingMasterSwordNearDL,     "Swords_MasterHilt1",       swordsMasterHilt.changedCvar,        20, gsDPSetGrayscaleColor(color.r, color.g, color.b, 255));
@@ -732,7 +747,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     //     }
     // }
     static CosmeticOption& swordsBiggoronBlade = cosmeticOptions.at("Swords.BiggoronBlade");
-    if (manualChange || CVarGetInteger(swordsBiggoronBlade.rainbowCvar, 0)) {
+    if (manualChange || swordsBiggoronBlade.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {swordsBiggoronBlade.defaultColor.x, swordsBiggoronBlade.defaultColor.y, swordsBiggoronBlade.defaultColor.z, swordsBiggoronBlade.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(swordsBiggoronBlade.cvar, defaultColor);
         PATCH_GFX(gLinkAdultLeftHandHoldingBgsFarDL,              "Swords_BiggoronBlade1",    swordsBiggoronBlade.changedCvar,    108, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
@@ -741,7 +756,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
         PATCH_GFX(gGiBiggoronSwordDL,                             "Swords_BiggoronBlade4",    swordsBiggoronBlade.changedCvar,      6, gsDPSetEnvColor(color.r / 3, color.g / 3, color.b / 3, 255));
     }
     // static CosmeticOption& swordsBiggoronHilt = cosmeticOptions.at("Swords.BiggoronHilt");
-    // if (manualChange || CVarGetInteger(swordsBiggoronHilt.rainbowCvar, 0)) {
+    // if (manualChange || swordsBiggoronHilt.rainbowColorChanged) {
     //     static Color_RGBA8 defaultColor = {swordsBiggoronHilt.defaultColor.x, swordsBiggoronHilt.defaultColor.y, swordsBiggoronHilt.defaultColor.z, swordsBiggoronHilt.defaultColor.w};
     //     Color_RGBA8 color = CVarGetColor(swordsBiggoronHilt.cvar, defaultColor);
     //     PATCH_GFX(gLinkAdultLeftHandHoldingBgsNearDL,             "Swords_BiggoronHilt1",     swordsBiggoronHilt.changedCvar,      20, gsDPSetGrayscaleColor(color.r, color.g, color.b, 255));
@@ -761,7 +776,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     // }   
 
     static CosmeticOption& glovesGoronBracelet = cosmeticOptions.at("Gloves.GoronBracelet");
-    if (manualChange || CVarGetInteger(glovesGoronBracelet.rainbowCvar, 0)) {
+    if (manualChange || glovesGoronBracelet.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {glovesGoronBracelet.defaultColor.x, glovesGoronBracelet.defaultColor.y, glovesGoronBracelet.defaultColor.z, glovesGoronBracelet.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(glovesGoronBracelet.cvar, defaultColor);
         PATCH_GFX(gGiGoronBraceletDL,                             "Gloves_GoronBracelet1",    glovesGoronBracelet.changedCvar,      5, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
@@ -774,21 +789,21 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
         }
     }
     static CosmeticOption& glovesSilverGauntlets = cosmeticOptions.at("Gloves.SilverGauntlets");
-    if (manualChange || CVarGetInteger(glovesSilverGauntlets.rainbowCvar, 0)) {
+    if (manualChange || glovesSilverGauntlets.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {glovesSilverGauntlets.defaultColor.x, glovesSilverGauntlets.defaultColor.y, glovesSilverGauntlets.defaultColor.z, glovesSilverGauntlets.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(glovesSilverGauntlets.cvar, defaultColor);
         PATCH_GFX(gGiSilverGauntletsColorDL,                      "Gloves_SilverGauntlets1",  glovesSilverGauntlets.changedCvar,    3, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
         PATCH_GFX(gGiSilverGauntletsColorDL,                      "Gloves_SilverGauntlets2",  glovesSilverGauntlets.changedCvar,    4, gsDPSetEnvColor(color.r / 3, color.g / 3, color.b / 3, 255));
     }
     static CosmeticOption& glovesGoldenGauntlets = cosmeticOptions.at("Gloves.GoldenGauntlets");
-    if (manualChange || CVarGetInteger(glovesGoldenGauntlets.rainbowCvar, 0)) {
+    if (manualChange || glovesGoldenGauntlets.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {glovesGoldenGauntlets.defaultColor.x, glovesGoldenGauntlets.defaultColor.y, glovesGoldenGauntlets.defaultColor.z, glovesGoldenGauntlets.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(glovesGoldenGauntlets.cvar, defaultColor);
         PATCH_GFX(gGiGoldenGauntletsColorDL,                      "Gloves_GoldenGauntlets1",  glovesGoldenGauntlets.changedCvar,    3, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
         PATCH_GFX(gGiGoldenGauntletsColorDL,                      "Gloves_GoldenGauntlets2",  glovesGoldenGauntlets.changedCvar,    4, gsDPSetEnvColor(color.r / 3, color.g / 3, color.b / 3, 255));
     }
     static CosmeticOption& glovesGauntletsGem = cosmeticOptions.at("Gloves.GauntletsGem");
-    if (manualChange || CVarGetInteger(glovesGauntletsGem.rainbowCvar, 0)) {
+    if (manualChange || glovesGauntletsGem.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {glovesGauntletsGem.defaultColor.x, glovesGauntletsGem.defaultColor.y, glovesGauntletsGem.defaultColor.z, glovesGauntletsGem.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(glovesGauntletsGem.cvar, defaultColor);
         PATCH_GFX(gGiGauntletsDL,                                 "Gloves_GauntletsGem1",     glovesGauntletsGem.changedCvar,      84, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
@@ -800,7 +815,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
 
     static CosmeticOption& equipmentBoomerangBody = cosmeticOptions.at("Equipment.BoomerangBody");
-    if (manualChange || CVarGetInteger(equipmentBoomerangBody.rainbowCvar, 0)) {
+    if (manualChange || equipmentBoomerangBody.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {equipmentBoomerangBody.defaultColor.x, equipmentBoomerangBody.defaultColor.y, equipmentBoomerangBody.defaultColor.z, equipmentBoomerangBody.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(equipmentBoomerangBody.cvar, defaultColor);
         PATCH_GFX(gGiBoomerangDL,                                 "Equipment_BoomerangBody1", equipmentBoomerangBody.changedCvar,   5, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
@@ -810,7 +825,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
         PATCH_GFX(gBoomerangDL,                                   "Equipment_BoomerangBody5", equipmentBoomerangBody.changedCvar,  39, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
     }
     static CosmeticOption& equipmentBoomerangGem = cosmeticOptions.at("Equipment.BoomerangGem");
-    if (manualChange || CVarGetInteger(equipmentBoomerangGem.rainbowCvar, 0)) {
+    if (manualChange || equipmentBoomerangGem.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {equipmentBoomerangGem.defaultColor.x, equipmentBoomerangGem.defaultColor.y, equipmentBoomerangGem.defaultColor.z, equipmentBoomerangGem.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(equipmentBoomerangGem.cvar, defaultColor);
         PATCH_GFX(gGiBoomerangDL,                                 "Equipment_BoomerangGem1",  equipmentBoomerangGem.changedCvar,   84, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
@@ -822,7 +837,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
 
     // static CosmeticOption& equipmentSlingshotBody = cosmeticOptions.at("Equipment.SlingshotBody");
-    // if (manualChange || CVarGetInteger(equipmentSlingshotBody.rainbowCvar, 0)) {
+    // if (manualChange || equipmentSlingshotBody.rainbowColorChanged) {
     //     static Color_RGBA8 defaultColor = {equipmentSlingshotBody.defaultColor.x, equipmentSlingshotBody.defaultColor.y, equipmentSlingshotBody.defaultColor.z, equipmentSlingshotBody.defaultColor.w};
     //     Color_RGBA8 color = CVarGetColor(equipmentSlingshotBody.cvar, defaultColor);
     //     PATCH_GFX(gGiSlingshotDL,                                 "Equipment_SlingshotBody1", equipmentSlingshotBody.changedCvar,  10, gsDPSetPrimColor(0, 0, MAX(color.r - 100, 0), MAX(color.g - 100, 0), MAX(color.b - 100, 0), 255));
@@ -846,7 +861,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     //     }
     // }
     static CosmeticOption& equipmentSlingshotString = cosmeticOptions.at("Equipment.SlingshotString");
-    if (manualChange || CVarGetInteger(equipmentSlingshotString.rainbowCvar, 0)) {
+    if (manualChange || equipmentSlingshotString.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {equipmentSlingshotString.defaultColor.x, equipmentSlingshotString.defaultColor.y, equipmentSlingshotString.defaultColor.z, equipmentSlingshotString.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(equipmentSlingshotString.cvar, defaultColor);
         PATCH_GFX(gGiSlingshotDL,                                 "Equipment_SlingshotString1",equipmentSlingshotString.changedCvar, 75, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
@@ -855,7 +870,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
 
     static CosmeticOption& equipmentBowTips = cosmeticOptions.at("Equipment.BowTips");
-    if (manualChange || CVarGetInteger(equipmentBowTips.rainbowCvar, 0)) {
+    if (manualChange || equipmentBowTips.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {equipmentBowTips.defaultColor.x, equipmentBowTips.defaultColor.y, equipmentBowTips.defaultColor.z, equipmentBowTips.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(equipmentBowTips.cvar, defaultColor);
         PATCH_GFX(gGiBowDL,                                       "Equipment_BowTips1",       equipmentBowTips.changedCvar,        86, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
@@ -865,7 +880,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
         PATCH_GFX(gLinkAdultRightHandHoldingBowFarDL,             "Equipment_BowTips5",       equipmentBowTips.changedCvar,        25, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
     }
     static CosmeticOption& equipmentBowString = cosmeticOptions.at("Equipment.BowString");
-    if (manualChange || CVarGetInteger(equipmentBowString.rainbowCvar, 0)) {
+    if (manualChange || equipmentBowString.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {equipmentBowString.defaultColor.x, equipmentBowString.defaultColor.y, equipmentBowString.defaultColor.z, equipmentBowString.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(equipmentBowString.cvar, defaultColor);
         PATCH_GFX(gGiBowDL,                                       "Equipment_BowString1",     equipmentBowString.changedCvar,     105, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
@@ -873,7 +888,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
         PATCH_GFX(gLinkAdultBowStringDL,                          "Equipment_BowString3",     equipmentBowString.changedCvar,       9, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
     }
     static CosmeticOption& equipmentBowBody = cosmeticOptions.at("Equipment.BowBody");
-    if (manualChange || CVarGetInteger(equipmentBowBody.rainbowCvar, 0)) {
+    if (manualChange || equipmentBowBody.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {equipmentBowBody.defaultColor.x, equipmentBowBody.defaultColor.y, equipmentBowBody.defaultColor.z, equipmentBowBody.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(equipmentBowBody.cvar, defaultColor);
         PATCH_GFX(gGiBowDL,                                       "Equipment_BowBody1",       equipmentBowBody.changedCvar,         5, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
@@ -883,7 +898,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
         PATCH_GFX(gLinkAdultRightHandHoldingBowFarDL,             "Equipment_BowBody5",       equipmentBowBody.changedCvar,        31, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
     }
     static CosmeticOption& equipmentBowHandle = cosmeticOptions.at("Equipment.BowHandle");
-    if (manualChange || CVarGetInteger(equipmentBowHandle.rainbowCvar, 0)) {
+    if (manualChange || equipmentBowHandle.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {equipmentBowHandle.defaultColor.x, equipmentBowHandle.defaultColor.y, equipmentBowHandle.defaultColor.z, equipmentBowHandle.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(equipmentBowHandle.cvar, defaultColor);
         PATCH_GFX(gGiBowDL,                                       "Equipment_BowHandle1",     equipmentBowHandle.changedCvar,      51, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
@@ -894,7 +909,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
 
     static CosmeticOption& equipmentHammerHead = cosmeticOptions.at("Equipment.HammerHead");
-    if (manualChange || CVarGetInteger(equipmentHammerHead.rainbowCvar, 0)) {
+    if (manualChange || equipmentHammerHead.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {equipmentHammerHead.defaultColor.x, equipmentHammerHead.defaultColor.y, equipmentHammerHead.defaultColor.z, equipmentHammerHead.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(equipmentHammerHead.cvar, defaultColor);
         PATCH_GFX(gGiHammerDL,                                    "Equipment_HammerHead1",    equipmentHammerHead.changedCvar,      5, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
@@ -905,7 +920,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
         PATCH_GFX(gLinkAdultLeftHandHoldingHammerFarDL,           "Equipment_HammerHead6",    equipmentHammerHead.changedCvar,     38, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
     }
     static CosmeticOption& equipmentHammerHandle = cosmeticOptions.at("Equipment.HammerHandle");
-    if (manualChange || CVarGetInteger(equipmentHammerHandle.rainbowCvar, 0)) {
+    if (manualChange || equipmentHammerHandle.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {equipmentHammerHandle.defaultColor.x, equipmentHammerHandle.defaultColor.y, equipmentHammerHandle.defaultColor.z, equipmentHammerHandle.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(equipmentHammerHandle.cvar, defaultColor);
         PATCH_GFX(gGiHammerDL,                                    "Equipment_HammerHandle1",  equipmentHammerHandle.changedCvar,   84, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
@@ -915,7 +930,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
 
     static CosmeticOption& equipmentChuFace = cosmeticOptions.at("Equipment.ChuFace");
-    if (manualChange || CVarGetInteger(equipmentChuFace.rainbowCvar, 0)) {
+    if (manualChange || equipmentChuFace.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {equipmentChuFace.defaultColor.x, equipmentChuFace.defaultColor.y, equipmentChuFace.defaultColor.z, equipmentChuFace.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(equipmentChuFace.cvar, defaultColor);
         PATCH_GFX(gGiBombchuDL,                                   "Equipment_ChuFace1",       equipmentChuFace.changedCvar,         5, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
@@ -928,7 +943,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
         }
     }
     static CosmeticOption& equipmentChuBody = cosmeticOptions.at("Equipment.ChuBody");
-    if (manualChange || CVarGetInteger(equipmentChuBody.rainbowCvar, 0)) {
+    if (manualChange || equipmentChuBody.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {equipmentChuBody.defaultColor.x, equipmentChuBody.defaultColor.y, equipmentChuBody.defaultColor.z, equipmentChuBody.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(equipmentChuBody.cvar, defaultColor);
         PATCH_GFX(gGiBombchuDL,                                   "Equipment_ChuBody1",       equipmentChuBody.changedCvar,        39, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
@@ -939,7 +954,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
 
     static CosmeticOption& equipmentBunnyHood = cosmeticOptions.at("Equipment.BunnyHood");
-    if (manualChange || CVarGetInteger(equipmentBunnyHood.rainbowCvar, 0)) {
+    if (manualChange || equipmentBunnyHood.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {equipmentBunnyHood.defaultColor.x, equipmentBunnyHood.defaultColor.y, equipmentBunnyHood.defaultColor.z, equipmentBunnyHood.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(equipmentBunnyHood.cvar, defaultColor);
         PATCH_GFX(gGiBunnyHoodDL,                                   "Equipment_BunnyHood1",       equipmentBunnyHood.changedCvar,        5, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
@@ -959,7 +974,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
 
     static CosmeticOption& consumableGreenRupee = cosmeticOptions.at("Consumable.GreenRupee");
-    if (manualChange || CVarGetInteger(consumableGreenRupee.rainbowCvar, 0)) {
+    if (manualChange || consumableGreenRupee.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {consumableGreenRupee.defaultColor.x, consumableGreenRupee.defaultColor.y, consumableGreenRupee.defaultColor.z, consumableGreenRupee.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(consumableGreenRupee.cvar, defaultColor);
         PATCH_GFX(gGiGreenRupeeInnerColorDL,                      "Consumable_GreenRupee1",   consumableGreenRupee.changedCvar,     3, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
@@ -979,7 +994,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
         }
     }
     static CosmeticOption& consumableBlueRupee = cosmeticOptions.at("Consumable.BlueRupee");
-    if (manualChange || CVarGetInteger(consumableBlueRupee.rainbowCvar, 0)) {
+    if (manualChange || consumableBlueRupee.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {consumableBlueRupee.defaultColor.x, consumableBlueRupee.defaultColor.y, consumableBlueRupee.defaultColor.z, consumableBlueRupee.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(consumableBlueRupee.cvar, defaultColor);
         PATCH_GFX(gGiBlueRupeeInnerColorDL,                       "Consumable_BlueRupee1",    consumableBlueRupee.changedCvar,      3, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
@@ -988,7 +1003,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
         PATCH_GFX(gGiBlueRupeeOuterColorDL,                       "Consumable_BlueRupee4",    consumableBlueRupee.changedCvar,      4, gsDPSetEnvColor(color.r * 0.75f, color.g * 0.75f, color.b * 0.75f, 255));
     }
     static CosmeticOption& consumableRedRupee = cosmeticOptions.at("Consumable.RedRupee");
-    if (manualChange || CVarGetInteger(consumableRedRupee.rainbowCvar, 0)) {
+    if (manualChange || consumableRedRupee.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {consumableRedRupee.defaultColor.x, consumableRedRupee.defaultColor.y, consumableRedRupee.defaultColor.z, consumableRedRupee.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(consumableRedRupee.cvar, defaultColor);
         PATCH_GFX(gGiRedRupeeInnerColorDL,                        "Consumable_RedRupee1",     consumableRedRupee.changedCvar,       3, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
@@ -997,7 +1012,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
         PATCH_GFX(gGiRedRupeeOuterColorDL,                        "Consumable_RedRupee4",     consumableRedRupee.changedCvar,       4, gsDPSetEnvColor(color.r * 0.75f, color.g * 0.75f, color.b * 0.75f, 255));
     }
     static CosmeticOption& consumablePurpleRupee = cosmeticOptions.at("Consumable.PurpleRupee");
-    if (manualChange || CVarGetInteger(consumablePurpleRupee.rainbowCvar, 0)) {
+    if (manualChange || consumablePurpleRupee.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {consumablePurpleRupee.defaultColor.x, consumablePurpleRupee.defaultColor.y, consumablePurpleRupee.defaultColor.z, consumablePurpleRupee.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(consumablePurpleRupee.cvar, defaultColor);
         PATCH_GFX(gGiPurpleRupeeInnerColorDL,                     "Consumable_PurpleRupee1",  consumablePurpleRupee.changedCvar,    3, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
@@ -1006,7 +1021,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
         PATCH_GFX(gGiPurpleRupeeOuterColorDL,                     "Consumable_PurpleRupee4",  consumablePurpleRupee.changedCvar,    4, gsDPSetEnvColor(color.r * 0.75f, color.g * 0.75f, color.b * 0.75f, 255));
     }
     static CosmeticOption& consumableGoldRupee = cosmeticOptions.at("Consumable.GoldRupee");
-    if (manualChange || CVarGetInteger(consumableGoldRupee.rainbowCvar, 0)) {
+    if (manualChange || consumableGoldRupee.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {consumableGoldRupee.defaultColor.x, consumableGoldRupee.defaultColor.y, consumableGoldRupee.defaultColor.z, consumableGoldRupee.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(consumableGoldRupee.cvar, defaultColor);
         PATCH_GFX(gGiGoldRupeeInnerColorDL,                       "Consumable_GoldRupee1",    consumableGoldRupee.changedCvar,      3, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
@@ -1016,7 +1031,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
 
     static CosmeticOption& consumableHearts = cosmeticOptions.at("Consumable.Hearts");
-    if (manualChange || CVarGetInteger(consumableHearts.rainbowCvar, 0)) {
+    if (manualChange || consumableHearts.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {consumableHearts.defaultColor.x, consumableHearts.defaultColor.y, consumableHearts.defaultColor.z, consumableHearts.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(consumableHearts.cvar, defaultColor);
         // PATCH_GFX(gGiRecoveryHeartDL,                             "Consumable_Hearts1",       consumableHearts.changedCvar,         4, gsDPSetGrayscaleColor(color.r, color.g, color.b, 255));
@@ -1031,7 +1046,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
         PATCH_GFX(gGiRedPotColorDL,                               "Consumable_Hearts10",      consumableHearts.changedCvar,         4, gsDPSetEnvColor(color.r / 2, color.g / 2, color.b / 2, 255));
     }
     static CosmeticOption& consumableMagic = cosmeticOptions.at("Consumable.Magic");
-    if (manualChange || CVarGetInteger(consumableMagic.rainbowCvar, 0)) {
+    if (manualChange || consumableMagic.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {consumableMagic.defaultColor.x, consumableMagic.defaultColor.y, consumableMagic.defaultColor.z, consumableMagic.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(consumableMagic.cvar, defaultColor);
         PATCH_GFX(gGiMagicJarSmallDL,                             "Consumable_Magic1",        consumableMagic.changedCvar,         31, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
@@ -1043,7 +1058,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
 
     static CosmeticOption& npcGoldenSkulltula = cosmeticOptions.at("NPC.GoldenSkulltula");
-    if (manualChange || CVarGetInteger(npcGoldenSkulltula.rainbowCvar, 0)) {
+    if (manualChange || npcGoldenSkulltula.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {npcGoldenSkulltula.defaultColor.x, npcGoldenSkulltula.defaultColor.y, npcGoldenSkulltula.defaultColor.z, npcGoldenSkulltula.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(npcGoldenSkulltula.cvar, defaultColor);
         PATCH_GFX(gSkulltulaTokenDL,                              "NPC_GoldenSkulltula1",     npcGoldenSkulltula.changedCvar,       5, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
@@ -1059,7 +1074,7 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
 
     static CosmeticOption& npcGerudo = cosmeticOptions.at("NPC.Gerudo");
-    if (manualChange || CVarGetInteger(npcGerudo.rainbowCvar, 0)) {
+    if (manualChange || npcGerudo.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {npcGerudo.defaultColor.x, npcGerudo.defaultColor.y, npcGerudo.defaultColor.z, npcGerudo.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(npcGerudo.cvar, defaultColor);
         PATCH_GFX(gGerudoPurpleTorsoDL,                           "NPC_Gerudo1",              npcGerudo.changedCvar,              139, gsDPSetEnvColor( color.r, color.g, color.b, 255));
@@ -1073,35 +1088,35 @@ void ApplyOrResetCustomGfxPatches(bool manualChange) {
     }
 
     static CosmeticOption& npcMetalTrap = cosmeticOptions.at("NPC.MetalTrap");
-    if (manualChange || CVarGetInteger(npcMetalTrap.rainbowCvar, 0)) {
+    if (manualChange || npcMetalTrap.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {npcMetalTrap.defaultColor.x, npcMetalTrap.defaultColor.y, npcMetalTrap.defaultColor.z, npcMetalTrap.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(npcMetalTrap.cvar, defaultColor);
         PATCH_GFX(gSlidingBladeTrapDL,                            "NPC_MetalTrap1",           npcMetalTrap.changedCvar,            59, gsDPSetPrimColor(0, 0, color.r, color.g, color.b, 255));
     }
 
     static CosmeticOption& n64LogoRed = cosmeticOptions.at("Title.N64LogoRed");
-    if (manualChange || CVarGetInteger(n64LogoRed.rainbowCvar, 0)) {
+    if (manualChange || n64LogoRed.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {n64LogoRed.defaultColor.x, n64LogoRed.defaultColor.y, n64LogoRed.defaultColor.z, n64LogoRed.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(n64LogoRed.cvar, defaultColor);
         PATCH_GFX(gNintendo64LogoDL,                              "Title_N64LogoRed1",          n64LogoRed.changedCvar,              17, gsDPSetPrimColor(0, 0, 255, 255, 255, 255))
         PATCH_GFX(gNintendo64LogoDL,                              "Title_N64LogoRed2",          n64LogoRed.changedCvar,              18, gsDPSetEnvColor(color.r, color.g, color.b, 128));
     }
     static CosmeticOption& n64LogoBlue = cosmeticOptions.at("Title.N64LogoBlue");
-    if (manualChange || CVarGetInteger(n64LogoBlue.rainbowCvar, 0)) {
+    if (manualChange || n64LogoBlue.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {n64LogoBlue.defaultColor.x, n64LogoBlue.defaultColor.y, n64LogoBlue.defaultColor.z, n64LogoBlue.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(n64LogoBlue.cvar, defaultColor);
         PATCH_GFX(gNintendo64LogoDL,                              "Title_N64LogoBlue1",         n64LogoBlue.changedCvar,             29, gsDPSetPrimColor(0, 0, 255, 255, 255, 255))
         PATCH_GFX(gNintendo64LogoDL,                              "Title_N64LogoBlue2",         n64LogoBlue.changedCvar,             30, gsDPSetEnvColor(color.r, color.g, color.b, 128));
     }
     static CosmeticOption& n64LogoGreen = cosmeticOptions.at("Title.N64LogoGreen");
-    if (manualChange || CVarGetInteger(n64LogoGreen.rainbowCvar, 0)) {
+    if (manualChange || n64LogoGreen.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {n64LogoGreen.defaultColor.x, n64LogoGreen.defaultColor.y, n64LogoGreen.defaultColor.z, n64LogoGreen.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(n64LogoGreen.cvar, defaultColor);
         PATCH_GFX(gNintendo64LogoDL,                              "Title_N64LogoGreen1",        n64LogoGreen.changedCvar,            56, gsDPSetPrimColor(0, 0, 255, 255, 255, 255))
         PATCH_GFX(gNintendo64LogoDL,                              "Title_N64LogoGreen2",        n64LogoGreen.changedCvar,            57, gsDPSetEnvColor(color.r, color.g, color.b, 128));
     }
     static CosmeticOption& n64LogoYellow = cosmeticOptions.at("Title.N64LogoYellow");
-    if (manualChange || CVarGetInteger(n64LogoYellow.rainbowCvar, 0)) {
+    if (manualChange || n64LogoYellow.rainbowColorChanged) {
         static Color_RGBA8 defaultColor = {n64LogoYellow.defaultColor.x, n64LogoYellow.defaultColor.y, n64LogoYellow.defaultColor.z, n64LogoYellow.defaultColor.w};
         Color_RGBA8 color = CVarGetColor(n64LogoYellow.cvar, defaultColor);
         PATCH_GFX(gNintendo64LogoDL,                              "Title_N64LogoYellow1",       n64LogoYellow.changedCvar,           81, gsDPSetPrimColor(0, 0, 255, 255, 255, 255))
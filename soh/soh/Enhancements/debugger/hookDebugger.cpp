@@ -92,6 +92,18 @@ void HookDebuggerWindow::DrawElement() {
     );
 #endif
 
+    const auto& stats = GameInteractor::lastFrameDispatchStats;
+    ImGui::Text("Last frame: %u dispatches, %u handler calls, %u vanilla behavior checks", stats.dispatches,
+                stats.handlerCalls, stats.shouldCalls);
+    ImGui::Checkbox("Time vanilla behavior checks", &GameInteractor::measureShouldTime);
+    UIWidgets::SetLastItemHoverText("Measures the time spent dispatching GameInteractor_Should each frame.\n"
+                                    "Reading the clock adds some cost of its own to every check.");
+    if (GameInteractor::measureShouldTime) {
+        ImGui::Text("Vanilla behavior checks took %.1fus (%.3fus per check)", stats.shouldTime.count(),
+                    stats.shouldCalls > 0 ? stats.shouldTime.count() / stats.shouldCalls : 0.0);
+    }
+    ImGui::Separator();
+
     for (auto& [hookName, _] : hookData) {
         if (ImGui::TreeNode(hookName)) {
             DrawHookRegisteringInfos(hookName);
@@ -2,6 +2,10 @@
 
 #include "performanceTimer.h"
 
+// Timers are kept per thread so that seeds generated in parallel each report their own phase times
+static thread_local std::array<std::chrono::duration<double, std::milli>, PT_MAX> totalTimes = {};
+static thread_local std::array<std::chrono::high_resolution_clock::time_point, PT_MAX> timeStarted = {};
+
 void StartPerformanceTimer(TimerID timer){
     timeStarted[timer] = std::chrono::high_resolution_clock::now();
 }
@@ -16,4 +20,29 @@ std::chrono::duration<double, std::milli> GetPerformanceTimer(TimerID timer){
 
 void ResetPerformanceTimers(){
     totalTimes = {};
-}
\ No newline at end of file
+}
+const char* GetPerformanceTimerName(TimerID timer){
+    static const std::array<const char*, PT_MAX> timerNames = {
+        "WholeSeed",
+        "LogicReset",
+        "RegionReset",
+        "SpoilerLog",
+        "EntranceShuffle",
+        "Shopsanity",
+        "OwnDungeon",
+        "LimitedChecks",
+        "AdvancementItems",
+        "RemainingItems",
+        "PlaythroughGeneration",
+        "PareDownPlaythrough",
+        "WotH",
+        "Foolish",
+        "Overrides",
+        "Hints",
+        "EventAccess",
+        "ToDAccess",
+        "EntranceLogic",
+        "LocationLogic",
+    };
+    return timerNames[timer];
+}
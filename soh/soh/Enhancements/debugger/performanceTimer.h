@@ -32,6 +32,5 @@ void StartPerformanceTimer(TimerID timer);
 void StopPerformanceTimer(TimerID timer);
 std::chrono::duration<double, std::milli> GetPerformanceTimer(TimerID timer);
 void ResetPerformanceTimers();
-static std::array<std::chrono::duration<double, std::milli>, PT_MAX> totalTimes = {};
-static std::array<std::chrono::high_resolution_clock::time_point, PT_MAX> timeStarted = {};
+const char* GetPerformanceTimerName(TimerID timer);
 
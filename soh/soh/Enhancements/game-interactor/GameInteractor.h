@@ -515,12 +515,15 @@ void GameInteractor_SetTriforceHuntCreditsWarpActive(uint8_t state);
 
 #ifdef __cplusplus
 #include <stdarg.h>
+#include <algorithm>
+#include <chrono>
 #include <thread>
 #include <unordered_map>
 #include <vector>
 #include <functional>
 #include <string>
 #include <version>
+#include <spdlog/spdlog.h>
 #ifdef __cpp_lib_source_location
 #include <source_location>
 #else
@@ -558,6 +561,13 @@ struct HookInfo {
     HookInfo(HookRegisteringInfo _registering) : calls(0), registering(_registering) {}
 };
 
+struct HookDispatchStats {
+    uint32_t dispatches = 0;
+    uint32_t handlerCalls = 0;
+    uint32_t shouldCalls = 0;
+    std::chrono::duration<double, std::micro> shouldTime{};
+};
+
 #ifdef __cpp_lib_source_location
 #define GET_CURRENT_REGISTERING_INFO(type) HookRegisteringInfo{location.file_name(), location.line(), location.column(), location.function_name(), type}
 #else
@@ -611,25 +621,55 @@ public:
 
     // Game Hooks
     HOOK_ID nextHookId = 1;
-    template <typename H> struct RegisteredGameHooks {
-        inline static std::unordered_map<HOOK_ID, typename H::fn> functions;
-        inline static std::unordered_map<int32_t, std::unordered_map<HOOK_ID, typename H::fn>> functionsForID;
-        inline static std::unordered_map<uintptr_t, std::unordered_map<HOOK_ID, typename H::fn>> functionsForPtr;
-        inline static std::unordered_map<HOOK_ID, std::pair<typename H::filter, typename H::fn>> functionsForFilter;
 
-        //Used for the hook debugger
-        inline static std::unordered_map<HOOK_ID, HookInfo> hookData;
+    template <typename F> struct RegisteredHook {
+        HOOK_ID id;
+        F function;
+        HookInfo info;
     };
+    template <typename F> using HookList = std::vector<RegisteredHook<F>>;
 
-    template <typename H> struct HooksToUnregister {
-        inline static std::vector<HOOK_ID> hooks;
-        inline static std::vector<HOOK_ID> hooksForID;
-        inline static std::vector<HOOK_ID> hooksForPtr;
-        inline static std::vector<HOOK_ID> hooksForFilter;
+    // Each hook type keeps its subscribers in flat lists that are walked in registration order. ID hooks are keyed on
+    // actor IDs, scene numbers and vanilla behavior flags, which are all small and non-negative, so they're stored in
+    // a table indexed by ID and dispatching an ID nothing subscribed to is a single range check.
+    template <typename H> struct RegisteredGameHooks {
+        inline static HookList<typename H::fn> functions;
+        inline static std::vector<HookList<typename H::fn>> functionsForID;
+        inline static std::unordered_map<uintptr_t, HookList<typename H::fn>> functionsForPtr;
+        inline static HookList<std::pair<typename H::filter, typename H::fn>> functionsForFilter;
     };
 
+    // Hooks can register and unregister other hooks, so changes made while a hook of the same type is being dispatched
+    // are held here and applied before its next dispatch, once nothing is walking the lists
+    template <typename H> struct DeferredHookChanges {
+        inline static uint32_t executing = 0;
+        inline static std::vector<std::function<void()>> changes;
+    };
+
+    // Dispatch cost, totalled over each game frame for the Hook Debugger
+    inline static HookDispatchStats frameDispatchStats;
+    inline static HookDispatchStats lastFrameDispatchStats;
+    inline static bool measureShouldTime = false;
+
     template <typename H> std::unordered_map<uint32_t, HookInfo> GetHookData() {
-        return RegisteredGameHooks<H>::hookData;
+        std::unordered_map<uint32_t, HookInfo> hookData;
+        for (auto& hook : RegisteredGameHooks<H>::functions) {
+            hookData[hook.id] = hook.info;
+        }
+        for (auto& hooks : RegisteredGameHooks<H>::functionsForID) {
+            for (auto& hook : hooks) {
+                hookData[hook.id] = hook.info;
+            }
+        }
+        for (auto& [ptr, hooks] : RegisteredGameHooks<H>::functionsForPtr) {
+            for (auto& hook : hooks) {
+                hookData[hook.id] = hook.info;
+            }
+        }
+        for (auto& hook : RegisteredGameHooks<H>::functionsForFilter) {
+            hookData[hook.id] = hook.info;
+        }
+        return hookData;
     }
 
     // General Hooks
@@ -639,32 +679,24 @@ public:
         , const std::source_location location = std::source_location::current()
 #endif
     ) {
-        // Ensure hook id is unique and not 0, which is reserved for invalid hooks
-        if (this->nextHookId == 0 || this->nextHookId >= UINT32_MAX) this->nextHookId = 1;
-        while (RegisteredGameHooks<H>::functions.find(this->nextHookId) != RegisteredGameHooks<H>::functions.end()) {
-            this->nextHookId++;
-        }
-
-        RegisteredGameHooks<H>::functions[this->nextHookId] = h;
-        RegisteredGameHooks<H>::hookData[this->nextHookId] = HookInfo{GET_CURRENT_REGISTERING_INFO(HOOK_TYPE_NORMAL)};
-        return this->nextHookId++;
+        HOOK_ID hookId = NextHookId();
+        HookInfo info{GET_CURRENT_REGISTERING_INFO(HOOK_TYPE_NORMAL)};
+        ChangeHooks<H>([hookId, h, info]() {
+            RegisteredGameHooks<H>::functions.push_back({ hookId, h, info });
+        });
+        return hookId;
     }
 
     template <typename H> void UnregisterGameHook(HOOK_ID hookId) {
         if (hookId == 0) return;
-        HooksToUnregister<H>::hooks.push_back(hookId);
+        ChangeHooks<H>([hookId]() {
+            RemoveHook(RegisteredGameHooks<H>::functions, hookId);
+        });
     }
 
     template <typename H, typename... Args> void ExecuteHooks(Args&&... args) {
-        for (auto& hookId : HooksToUnregister<H>::hooks) {
-            RegisteredGameHooks<H>::functions.erase(hookId);
-            RegisteredGameHooks<H>::hookData.erase(hookId);
-        }
-        HooksToUnregister<H>::hooks.clear();
-        for (auto& hook : RegisteredGameHooks<H>::functions) {
-            hook.second(std::forward<Args>(args)...);
-            RegisteredGameHooks<H>::hookData[hook.first].calls += 1;
-        }
+        PrepareDispatch<H>();
+        DispatchHooks<H>(RegisteredGameHooks<H>::functions, std::forward<Args>(args)...);
     }
 
     // ID based Hooks
@@ -674,37 +706,41 @@ public:
         , const std::source_location location = std::source_location::current()
 #endif
     ) {
-        if (this->nextHookId == 0 || this->nextHookId >= UINT32_MAX) this->nextHookId = 1;
-        while (RegisteredGameHooks<H>::functionsForID[id].find(this->nextHookId) != RegisteredGameHooks<H>::functionsForID[id].end()) {
-            this->nextHookId++;
+        // IDs index functionsForID, so a negative one would resize it past what it can hold
+        if (id < 0) {
+            SPDLOG_ERROR("RegisterGameHookForID: ignoring hook with negative ID {}", id);
+            return 0;
         }
-
-        RegisteredGameHooks<H>::functionsForID[id][this->nextHookId] = h;
-        RegisteredGameHooks<H>::hookData[this->nextHookId] = HookInfo{GET_CURRENT_REGISTERING_INFO(HOOK_TYPE_ID)};
-        return this->nextHookId++;
+        HOOK_ID hookId = NextHookId();
+        HookInfo info{GET_CURRENT_REGISTERING_INFO(HOOK_TYPE_ID)};
+        ChangeHooks<H>([id, hookId, h, info]() {
+            auto& functionsForID = RegisteredGameHooks<H>::functionsForID;
+            if (functionsForID.size() <= (size_t)id) {
+                functionsForID.resize(id + 1);
+            }
+            functionsForID[id].push_back({ hookId, h, info });
+        });
+        return hookId;
     }
 
     template <typename H> void UnregisterGameHookForID(HOOK_ID hookId) {
         if (hookId == 0) return;
-        HooksToUnregister<H>::hooksForID.push_back(hookId);
+        ChangeHooks<H>([hookId]() {
+            for (auto& hooks : RegisteredGameHooks<H>::functionsForID) {
+                if (RemoveHook(hooks, hookId)) {
+                    break;
+                }
+            }
+        });
     }
 
     template <typename H, typename... Args> void ExecuteHooksForID(int32_t id, Args&&... args) {
-        for (auto& hookId : HooksToUnregister<H>::hooksForID) {
-            for (auto it = RegisteredGameHooks<H>::functionsForID[id].begin(); it != RegisteredGameHooks<H>::functionsForID[id].end(); ) {
-                if (it->first == hookId) {
-                    it = RegisteredGameHooks<H>::functionsForID[id].erase(it);
-                    HooksToUnregister<H>::hooksForID.erase(std::remove(HooksToUnregister<H>::hooksForID.begin(), HooksToUnregister<H>::hooksForID.end(), hookId), HooksToUnregister<H>::hooksForID.end());
-                    RegisteredGameHooks<H>::hookData.erase(hookId);
-                } else {
-                    ++it;
-                }
-            }
-        }
-        for (auto& hook : RegisteredGameHooks<H>::functionsForID[id]) {
-            hook.second(std::forward<Args>(args)...);
-            RegisteredGameHooks<H>::hookData[hook.first].calls += 1;
+        PrepareDispatch<H>();
+        auto& functionsForID = RegisteredGameHooks<H>::functionsForID;
+        if ((uint32_t)id >= functionsForID.size()) {
+            return;
         }
+        DispatchHooks<H>(functionsForID[id], std::forward<Args>(args)...);
     }
 
     // PTR based Hooks
@@ -714,37 +750,41 @@ public:
         , const std::source_location location = std::source_location::current()
 #endif
     ) {
-        if (this->nextHookId == 0 || this->nextHookId >= UINT32_MAX) this->nextHookId = 1;
-        while (RegisteredGameHooks<H>::functionsForPtr[ptr].find(this->nextHookId) != RegisteredGameHooks<H>::functionsForPtr[ptr].end()) {
-            this->nextHookId++;
-        }
-
-        RegisteredGameHooks<H>::functionsForPtr[ptr][this->nextHookId] = h;
-        RegisteredGameHooks<H>::hookData[this->nextHookId] = HookInfo{GET_CURRENT_REGISTERING_INFO(HOOK_TYPE_PTR)};
-        return this->nextHookId++;
+        HOOK_ID hookId = NextHookId();
+        HookInfo info{GET_CURRENT_REGISTERING_INFO(HOOK_TYPE_PTR)};
+        ChangeHooks<H>([ptr, hookId, h, info]() {
+            RegisteredGameHooks<H>::functionsForPtr[ptr].push_back({ hookId, h, info });
+        });
+        return hookId;
     }
 
     template <typename H> void UnregisterGameHookForPtr(HOOK_ID hookId) {
         if (hookId == 0) return;
-        HooksToUnregister<H>::hooksForPtr.push_back(hookId);
+        ChangeHooks<H>([hookId]() {
+            auto& functionsForPtr = RegisteredGameHooks<H>::functionsForPtr;
+            for (auto it = functionsForPtr.begin(); it != functionsForPtr.end(); ++it) {
+                if (RemoveHook(it->second, hookId)) {
+                    // Pointers are usually actors, so drop the list rather than keep one for every address ever used
+                    if (it->second.empty()) {
+                        functionsForPtr.erase(it);
+                    }
+                    break;
+                }
+            }
+        });
     }
 
     template <typename H, typename... Args> void ExecuteHooksForPtr(uintptr_t ptr, Args&&... args) {
-        for (auto& hookId : HooksToUnregister<H>::hooksForPtr) {
-            for (auto it = RegisteredGameHooks<H>::functionsForPtr[ptr].begin(); it != RegisteredGameHooks<H>::functionsForPtr[ptr].end(); ) {
-                if (it->first == hookId) {
-                    it = RegisteredGameHooks<H>::functionsForPtr[ptr].erase(it);
-                    HooksToUnregister<H>::hooksForPtr.erase(std::remove(HooksToUnregister<H>::hooksForPtr.begin(), HooksToUnregister<H>::hooksForPtr.end(), hookId), HooksToUnregister<H>::hooksForPtr.end());
-                    RegisteredGameHooks<H>::hookData.erase(hookId);
-                } else {
-                    ++it;
-                }
-            }
+        PrepareDispatch<H>();
+        auto& functionsForPtr = RegisteredGameHooks<H>::functionsForPtr;
+        if (functionsForPtr.empty()) {
+            return;
         }
-        for (auto& hook : RegisteredGameHooks<H>::functionsForPtr[ptr]) {
-            hook.second(std::forward<Args>(args)...);
-            RegisteredGameHooks<H>::hookData[hook.first].calls += 1;
+        auto hooks = functionsForPtr.find(ptr);
+        if (hooks == functionsForPtr.end()) {
+            return;
         }
+        DispatchHooks<H>(hooks->second, std::forward<Args>(args)...);
     }
 
     // Filter based Hooks
@@ -754,35 +794,95 @@ public:
         , const std::source_location location = std::source_location::current()
 #endif
     ) {
-        if (this->nextHookId == 0 || this->nextHookId >= UINT32_MAX) this->nextHookId = 1;
-        while (RegisteredGameHooks<H>::functionsForFilter.find(this->nextHookId) != RegisteredGameHooks<H>::functionsForFilter.end()) {
-            this->nextHookId++;
-        }
-
-        RegisteredGameHooks<H>::functionsForFilter[this->nextHookId] = std::make_pair(f, h);
-        RegisteredGameHooks<H>::hookData[this->nextHookId] = HookInfo{GET_CURRENT_REGISTERING_INFO(HOOK_TYPE_FILTER)};
-        return this->nextHookId++;
+        HOOK_ID hookId = NextHookId();
+        HookInfo info{GET_CURRENT_REGISTERING_INFO(HOOK_TYPE_FILTER)};
+        ChangeHooks<H>([hookId, f, h, info]() {
+            RegisteredGameHooks<H>::functionsForFilter.push_back({ hookId, std::make_pair(f, h), info });
+        });
+        return hookId;
     }
 
     template <typename H> void UnregisterGameHookForFilter(HOOK_ID hookId) {
         if (hookId == 0) return;
-        HooksToUnregister<H>::hooksForFilter.push_back(hookId);
+        ChangeHooks<H>([hookId]() {
+            RemoveHook(RegisteredGameHooks<H>::functionsForFilter, hookId);
+        });
     }
 
     template <typename H, typename... Args> void ExecuteHooksForFilter(Args&&... args) {
-        for (auto& hookId : HooksToUnregister<H>::hooksForFilter) {
-            RegisteredGameHooks<H>::functionsForFilter.erase(hookId);
-            RegisteredGameHooks<H>::hookData.erase(hookId);
+        PrepareDispatch<H>();
+        auto& hooks = RegisteredGameHooks<H>::functionsForFilter;
+        if (hooks.empty()) {
+            return;
         }
-        HooksToUnregister<H>::hooksForFilter.clear();
-        for (auto& hook : RegisteredGameHooks<H>::functionsForFilter) {
-            if (hook.second.first(std::forward<Args>(args)...)) {
-                hook.second.second(std::forward<Args>(args)...);
-                RegisteredGameHooks<H>::hookData[hook.first].calls += 1;
+        DeferredHookChanges<H>::executing++;
+        for (auto& hook : hooks) {
+            if (hook.function.first(std::forward<Args>(args)...)) {
+                hook.function.second(std::forward<Args>(args)...);
+                hook.info.calls += 1;
+                frameDispatchStats.handlerCalls++;
             }
         }
+        DeferredHookChanges<H>::executing--;
+    }
+
+    // Called once per game frame to publish the dispatch stats gathered over it
+    static void FinishHookDispatchFrame() {
+        lastFrameDispatchStats = frameDispatchStats;
+        frameDispatchStats = HookDispatchStats{};
+    }
+
+private:
+    HOOK_ID NextHookId() {
+        // Hook ids are never 0, which is reserved for invalid hooks
+        if (this->nextHookId == 0 || this->nextHookId >= UINT32_MAX) this->nextHookId = 1;
+        return this->nextHookId++;
     }
 
+    template <typename H> static void ChangeHooks(std::function<void()>&& change) {
+        if (DeferredHookChanges<H>::executing == 0) {
+            change();
+        } else {
+            DeferredHookChanges<H>::changes.push_back(std::move(change));
+        }
+    }
+
+    template <typename H> static void PrepareDispatch() {
+        frameDispatchStats.dispatches++;
+        if (!DeferredHookChanges<H>::changes.empty() && DeferredHookChanges<H>::executing == 0) {
+            for (auto& change : DeferredHookChanges<H>::changes) {
+                change();
+            }
+            DeferredHookChanges<H>::changes.clear();
+        }
+    }
+
+    template <typename H, typename... Args> static void DispatchHooks(HookList<typename H::fn>& hooks, Args&&... args) {
+        if (hooks.empty()) {
+            return;
+        }
+        DeferredHookChanges<H>::executing++;
+        for (auto& hook : hooks) {
+            hook.function(std::forward<Args>(args)...);
+            hook.info.calls += 1;
+        }
+        frameDispatchStats.handlerCalls += hooks.size();
+        DeferredHookChanges<H>::executing--;
+    }
+
+    template <typename F> static bool RemoveHook(HookList<F>& hooks, HOOK_ID hookId) {
+        auto it = std::find_if(hooks.begin(), hooks.end(), [hookId](const RegisteredHook<F>& hook) {
+            return hook.id == hookId;
+        });
+        if (it == hooks.end()) {
+            return false;
+        }
+        hooks.erase(it);
+        return true;
+    }
+
+public:
+
     class HookFilter {
     public:
         static auto ActorNotPlayer(Actor* actor) {
@@ -11,6 +11,7 @@ void GameInteractor_ExecuteOnExitGame(int32_t fileNum) {
 }
 
 void GameInteractor_ExecuteOnGameFrameUpdate() {
+    GameInteractor::FinishHookDispatchFrame();
     GameInteractor::Instance->ExecuteHooks<GameInteractor::OnGameFrameUpdate>();
 }
 
@@ -144,10 +145,20 @@ bool GameInteractor_Should(GIVanillaBehavior flag, u32 result, ...) {
     // Here we downcast back to a bool for our actual hook handlers
     bool boolResult = static_cast<bool>(result);
 
+    std::chrono::steady_clock::time_point start;
+    if (GameInteractor::measureShouldTime) {
+        start = std::chrono::steady_clock::now();
+    }
+
     GameInteractor::Instance->ExecuteHooks<GameInteractor::OnVanillaBehavior>(flag, &boolResult, args);
     GameInteractor::Instance->ExecuteHooksForID<GameInteractor::OnVanillaBehavior>(flag, flag, &boolResult, args);
     GameInteractor::Instance->ExecuteHooksForFilter<GameInteractor::OnVanillaBehavior>(flag, &boolResult, args);
 
+    GameInteractor::frameDispatchStats.shouldCalls++;
+    if (GameInteractor::measureShouldTime) {
+        GameInteractor::frameDispatchStats.shouldTime += std::chrono::steady_clock::now() - start;
+    }
+
     va_end(args);
     return boolResult;
 }
@@ -363,6 +363,9 @@ const std::vector<const char*> cheatCvars = {
     CVAR_STATS_WINDOW_OPEN,
     CVAR_CHEAT("SaveStatesEnabled"),
     CVAR_CHEAT("SaveStatePromise"),
+    CVAR_CHEAT("SaveStateRewind"),
+    CVAR_CHEAT("SaveStateRewindInterval"),
+    CVAR_CHEAT("SaveStateRewindMemory"),
     CVAR_DEVELOPER_TOOLS("RegEditEnabled"),
     CVAR_CHEAT("DekuStick"),
     CVAR_DEVELOPER_TOOLS("DebugWarpScreenTranslation"),
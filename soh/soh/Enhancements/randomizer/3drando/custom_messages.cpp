@@ -119,8 +119,8 @@ constexpr std::array DungeonColors = {
     QM_RED,
 };
 
-    std::set<MessageEntry, MessageEntryComp> messageEntries;
-    std::stringstream messageData;
+    thread_local std::set<MessageEntry, MessageEntryComp> messageEntries;
+    thread_local std::stringstream messageData;
 
     //textBoxType and textBoxPosition are defined here: https://wiki.cloudmodding.com/oot/Text_Format#Message_Id
     void CreateMessage(uint32_t textId, uint32_t unk_04, uint32_t textBoxType, uint32_t textBoxPosition,
@@ -14,6 +14,7 @@
 #include "soh/Enhancements/randomizer/static_data.h"
 #include "soh/Enhancements/debugger/performanceTimer.h"
 
+#include <array>
 #include <vector>
 #include <list>
 #include <set>
@@ -23,7 +24,7 @@ using namespace CustomMessages;
 using namespace Rando;
 
 
-static bool placementFailure = false;
+static thread_local bool placementFailure = false;
 
 
 PriceSettingsStruct shopsanityPrices = {RSK_SHOPSANITY_PRICES, 
@@ -188,7 +189,6 @@ static void ValidateSphereZero(GetAccessibleLocationsStruct& gals){
 //This function handles each possible exit
 void ProcessExits(Region* region, GetAccessibleLocationsStruct& gals, RandomizerGet ignore = RG_NONE, 
                   bool stopOnBeatable = false, bool addToPlaythrough = false){
-  auto ctx = Rando::Context::GetInstance();
   for (auto& exit : region->exits) {
     Region* exitRegion = exit.GetConnectedRegion();
     //Update Time of Day Access for the exit
@@ -316,6 +316,7 @@ bool IsBeatableWithout(RandomizerCheck excludedCheck, bool replaceItem, Randomiz
 
 // Reset non-Logic-class logic, and optionally apply the initial inventory
 void ResetLogic(std::shared_ptr<Context>& ctx, GetAccessibleLocationsStruct& gals, bool applyInventory = false){
+  ResolveConditionRules();
   gals.timePassChildDay = true;
   gals.timePassChildNight = true;
   gals.timePassAdultDay = true;
@@ -391,8 +392,9 @@ void ApplyOrStoreItem(Rando::ItemLocation* loc, GetAccessibleLocationsStruct& ga
 }
 
 // Adds the contents of a location to the current progression and optionally playthrough
+//Runs for every location of every region a search visits, so it uses the ctx and logic shorthands
+//set up by RegionTable_Init rather than looking up the Context
 bool AddCheckToLogic(LocationAccess& locPair, GetAccessibleLocationsStruct& gals, RandomizerGet ignore, bool stopOnBeatable, bool addToPlaythrough=false){
-  auto ctx = Rando::Context::GetInstance();
   StartPerformanceTimer(PT_LOCATION_LOGIC);
   RandomizerCheck loc = locPair.GetLocation();
   Rando::ItemLocation* location = ctx->GetItemLocation(loc);
@@ -487,7 +489,7 @@ void ProcessRegion(Region* region, GetAccessibleLocationsStruct& gals, Randomize
   PropagateTimeTravel(gals, ignore, stopOnBeatable, addToPlaythrough);
   for (size_t k = 0; k < region->locations.size(); k++) {
     if(AddCheckToLogic(region->locations[k], gals, ignore, stopOnBeatable, addToPlaythrough)){
-      Rando::Context::GetInstance()->playthroughBeatable = true;
+      ctx->playthroughBeatable = true;
       return;
     }
   }
@@ -557,6 +559,164 @@ bool CheckBeatable(RandomizerGet ignore /* = RG_NONE*/) {
   return false;
 }
 
+// Everything a search writes to in the shared world graph. Saving it lets a search be paused while other
+// searches run, then resumed from the same frontier instead of starting over from the root
+struct SearchSnapshot {
+  GetAccessibleLocationsStruct gals = GetAccessibleLocationsStruct(0);
+  // The copied save context pointer belongs to the live Logic and is never read from here
+  Logic logic;
+  SaveContext saveContext;
+  std::array<std::array<bool, 5>, RR_MAX> regionAccess = {};
+  std::array<bool, RC_MAX> locationsInPool = {};
+  bool started = false;
+};
+
+static void SaveSearchSnapshot(SearchSnapshot& snapshot) {
+  auto ctx = Rando::Context::GetInstance();
+  snapshot.logic = *logic;
+  snapshot.saveContext = *logic->mSaveContext;
+  for (size_t i = 0; i < RR_MAX; i++) {
+    Region* region = RegionTable((RandomizerRegion)i);
+    snapshot.regionAccess[i] = { region->childDay, region->childNight, region->adultDay, region->adultNight, region->addedToPool };
+  }
+  for (size_t i = 0; i < RC_MAX; i++) {
+    snapshot.locationsInPool[i] = ctx->GetItemLocation(i)->IsAddedToPool();
+  }
+}
+
+static void RestoreSearchSnapshot(const SearchSnapshot& snapshot) {
+  auto ctx = Rando::Context::GetInstance();
+  SaveContext* saveContext = logic->mSaveContext;
+  *logic = snapshot.logic;
+  logic->mSaveContext = saveContext;
+  *saveContext = snapshot.saveContext;
+  for (size_t i = 0; i < RR_MAX; i++) {
+    Region* region = RegionTable((RandomizerRegion)i);
+    region->childDay = snapshot.regionAccess[i][0];
+    region->childNight = snapshot.regionAccess[i][1];
+    region->adultDay = snapshot.regionAccess[i][2];
+    region->adultNight = snapshot.regionAccess[i][3];
+    region->addedToPool = snapshot.regionAccess[i][4];
+  }
+  for (size_t i = 0; i < RC_MAX; i++) {
+    if (snapshot.locationsInPool[i]) {
+      ctx->GetItemLocation(i)->AddToPool();
+    } else {
+      ctx->GetItemLocation(i)->RemoveFromPool();
+    }
+  }
+}
+
+// Same result as CheckBeatable, for a fill that only ever adds items to locations. Access only grows as
+// items are placed, so the search picks up from where the previous call stopped, and a newly placed item
+// only matters once its location has been reached.
+static bool CheckBeatableIncremental(SearchSnapshot& snapshot, RandomizerCheck placedLocation) {
+  auto ctx = Rando::Context::GetInstance();
+  ctx->playthroughBeatable = false;
+  if (!snapshot.started) {
+    logic->Reset();
+    snapshot.gals = GetAccessibleLocationsStruct(0);
+    ResetLogic(ctx, snapshot.gals, true);
+    snapshot.started = true;
+  } else {
+    RestoreSearchSnapshot(snapshot);
+    Rando::ItemLocation* location = ctx->GetItemLocation(placedLocation);
+    if (!location->IsAddedToPool()) {
+      // Not reached yet, so the search will collect the item whenever it gets there
+      return false;
+    }
+    // The location was empty when it was reached, collect what was just placed there
+    location->ApplyPlacedItemEffect();
+    if (location->GetPlacedRandomizerGet() == RG_TRIFORCE) {
+      ctx->playthroughBeatable = true;
+      return true;
+    }
+    snapshot.gals.logicUpdated = true;
+  }
+
+  do {
+    snapshot.gals.InitLoop();
+    for (size_t i = 0; i < snapshot.gals.regionPool.size() && !ctx->playthroughBeatable; i++) {
+      ProcessRegion(RegionTable(snapshot.gals.regionPool[i]), snapshot.gals, RG_NONE, true);
+    }
+  } while (snapshot.gals.logicUpdated && !ctx->playthroughBeatable);
+
+  SaveSearchSnapshot(snapshot);
+  return ctx->playthroughBeatable;
+}
+
+// A CheckBeatable search from the root, with a snapshot saved at the start of every pass over the region pool.
+// Emptying a location doesn't change anything the search did before that location was reached, so asking
+// whether the seed is beatable without one item can resume from the pass that reached it.
+struct BeatableSearchRecord {
+  std::vector<SearchSnapshot> passes;
+  std::array<int, RC_MAX> reachedInPass = {};
+  bool beatable = false;
+};
+
+static void RecordBeatableSearch(BeatableSearchRecord& record) {
+  auto ctx = Rando::Context::GetInstance();
+  record.passes.clear();
+  record.reachedInPass.fill(-1);
+  ctx->playthroughBeatable = false;
+  logic->Reset();
+  GetAccessibleLocationsStruct gals(0);
+  ResetLogic(ctx, gals, true);
+  do {
+    record.passes.emplace_back();
+    record.passes.back().gals = gals;
+    SaveSearchSnapshot(record.passes.back());
+    gals.InitLoop();
+    for (size_t i = 0; i < gals.regionPool.size() && !ctx->playthroughBeatable; i++) {
+      ProcessRegion(RegionTable(gals.regionPool[i]), gals, RG_NONE, true);
+    }
+    for (size_t i = 0; i < RC_MAX; i++) {
+      if (record.reachedInPass[i] < 0 && ctx->GetItemLocation(i)->IsAddedToPool()) {
+        record.reachedInPass[i] = record.passes.size() - 1;
+      }
+    }
+  } while (gals.logicUpdated && !ctx->playthroughBeatable);
+  record.beatable = ctx->playthroughBeatable;
+}
+
+// The first pass of a recorded search that a location's item could have changed, or the number of passes if
+// the search finished without reaching it
+static size_t FirstAffectedPass(const BeatableSearchRecord& record, RandomizerCheck loc) {
+  return record.reachedInPass[loc] < 0 ? record.passes.size() : record.reachedInPass[loc];
+}
+
+// Same result as IsBeatableWithout with no ignored item. Passes from resumeLimit on are treated as stale,
+// for when locations the recorded search reached have been emptied since.
+static bool IsBeatableWithoutRecorded(const BeatableSearchRecord& record, RandomizerCheck excludedCheck,
+                                      bool replaceItem, size_t resumeLimit) {
+  auto ctx = Rando::Context::GetInstance();
+  Rando::ItemLocation* location = ctx->GetItemLocation(excludedCheck);
+  RandomizerGet copy = location->GetPlacedRandomizerGet();
+  location->SetPlacedItem(RG_NONE);
+
+  size_t resumePass = std::min(FirstAffectedPass(record, excludedCheck), resumeLimit);
+  if (resumePass >= record.passes.size()) {
+    // Nothing the recorded search collected has changed, so neither has its result
+    ctx->playthroughBeatable = record.beatable;
+  } else {
+    ctx->playthroughBeatable = false;
+    const SearchSnapshot& pass = record.passes[resumePass];
+    RestoreSearchSnapshot(pass);
+    GetAccessibleLocationsStruct gals = pass.gals;
+    do {
+      gals.InitLoop();
+      for (size_t i = 0; i < gals.regionPool.size() && !ctx->playthroughBeatable; i++) {
+        ProcessRegion(RegionTable(gals.regionPool[i]), gals, RG_NONE, true);
+      }
+    } while (gals.logicUpdated && !ctx->playthroughBeatable);
+  }
+
+  if (replaceItem) {
+    location->SetPlacedItem(copy);
+  }
+  return ctx->playthroughBeatable;
+}
+
 // Check if the currently randomised set of entrances is a valid game map.
 void ValidateEntrances(bool checkPoeCollectorAccess, bool checkOtherEntranceAccess) {
   auto ctx = Rando::Context::GetInstance();
@@ -663,6 +823,10 @@ void SetAreas(){
 static void PareDownPlaythrough() {
   auto ctx = Rando::Context::GetInstance();
   std::vector<RandomizerCheck> toAddBackItem;
+  BeatableSearchRecord record;
+  RecordBeatableSearch(record);
+  //Removed items stay out for the rest of the pare down, so recorded passes from where they were reached are stale
+  size_t resumeLimit = record.passes.size();
   //Start at sphere before Ganon's and count down
   for (int i = ctx->playthroughLocations.size() - 2; i >= 0; i--) {
     //Check each item location in sphere
@@ -678,8 +842,12 @@ static void PareDownPlaythrough() {
         ignore = locGet;
       }
 
+      //Searches ignoring an item don't follow the recorded one, so those start over from the root
+      bool beatable = ignore == RG_NONE ? IsBeatableWithoutRecorded(record, loc, false, resumeLimit)
+                                        : IsBeatableWithout(loc, false, ignore);
       //Playthrough is still beatable without this item, therefore it can be removed from playthrough section.
-      if (IsBeatableWithout(loc, false, ignore)) {
+      if (beatable) {
+        resumeLimit = std::min(resumeLimit, FirstAffectedPass(record, loc));
         ctx->playthroughLocations[i].erase(ctx->playthroughLocations[i].begin() + j);
         ctx->GetItemLocation(loc)->SetDelayedItem(locGet); //Game is still beatable, don't add back until later
         toAddBackItem.push_back(loc);
@@ -709,6 +877,9 @@ static void PareDownPlaythrough() {
 // are just possible items you *can* collect to complete the seed.
 static void CalculateWotH() {
   auto ctx = Rando::Context::GetInstance();
+  //Every item is put back after its check, so one recorded search serves them all
+  BeatableSearchRecord record;
+  RecordBeatableSearch(record);
   //size - 1 so Triforce is not counted
   for (size_t i = 0; i < ctx->playthroughLocations.size() - 1; i++) {
     for (size_t j = 0; j < ctx->playthroughLocations[i].size(); j++) {
@@ -716,7 +887,7 @@ static void CalculateWotH() {
       //so add it unless it is in Links Pocket or an isolated place.
       auto itemLoc = ctx->GetItemLocation(ctx->playthroughLocations[i][j]);
       if (itemLoc->IsHintable() && itemLoc->GetFirstArea() > RA_LINKS_POCKET &&
-          !(IsBeatableWithout(ctx->playthroughLocations[i][j], true))) {
+          !(IsBeatableWithoutRecorded(record, ctx->playthroughLocations[i][j], true, record.passes.size()))) {
         itemLoc->SetWothCandidate();
       }
     }
@@ -825,6 +996,7 @@ static void AssumedFill(const std::vector<RandomizerGet>& items, const std::vect
         }
         unsuccessfulPlacement = false;
         std::vector<RandomizerGet> itemsToPlace = items;
+        SearchSnapshot beatableSearch;
 
         // copy all not yet placed advancement items so that we can apply their effects for the fill algorithm
         std::vector<RandomizerGet> itemsToNotPlace =
@@ -887,10 +1059,7 @@ static void AssumedFill(const std::vector<RandomizerGet>& items, const std::vect
             // If ALR is off, then we check beatability after placing the item.
             // If the game is beatable, then we can stop placing items with logic.
             if (!ctx->GetOption(RSK_ALL_LOCATIONS_REACHABLE)) {
-                ctx->playthroughBeatable = false;
-                logic->Reset();
-                CheckBeatable();
-                if (ctx->playthroughBeatable) {
+                if (CheckBeatableIncremental(beatableSearch, selectedLocation)) {
                     SPDLOG_DEBUG("Game beatable, now placing items randomly. " + std::to_string(itemsToPlace.size()) +
                                 " major items remaining.\n\n");
                     FastFill(itemsToPlace, GetEmptyLocations(allowedLocations), true);
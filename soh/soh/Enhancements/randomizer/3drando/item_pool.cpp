@@ -10,8 +10,8 @@
 #include "z64item.h"
 #include <spdlog/spdlog.h>
 
-std::vector<RandomizerGet> ItemPool = {};
-std::vector<RandomizerGet> PendingJunkPool = {};
+thread_local std::vector<RandomizerGet> ItemPool = {};
+thread_local std::vector<RandomizerGet> PendingJunkPool = {};
 const std::array<RandomizerGet, 9> dungeonRewards = {
   RG_KOKIRI_EMERALD,
   RG_GORON_RUBY,
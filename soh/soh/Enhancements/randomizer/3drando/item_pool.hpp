@@ -13,4 +13,4 @@ void PlaceJunkInExcludedLocation(const RandomizerCheck il);
 void GenerateItemPool();
 void AddJunk();
 
-extern std::vector<RandomizerGet> ItemPool;
+extern thread_local std::vector<RandomizerGet> ItemPool;
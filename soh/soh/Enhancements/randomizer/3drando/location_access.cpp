@@ -12,7 +12,7 @@
 #include <fstream>
 
 //generic grotto event list
-std::vector<EventAccess> grottoEvents;
+thread_local std::vector<EventAccess> grottoEvents;
 
 //set the logic to be a specific age and time of day and see if the condition still holds
 bool LocationAccess::CheckConditionAtAgeTime(bool& age, bool& time) const {
@@ -32,7 +32,7 @@ bool LocationAccess::ConditionsMet() const {
   //WARNING enterance validation can run this after resetting the access for sphere 0 validation
   //When refactoring ToD access, either fix the above or do not assume that we
   //have any access at all just because this is being run
-  Region* parentRegion = RegionTable(Rando::Context::GetInstance()->GetItemLocation(location)->GetParentRegionKey());
+  Region* parentRegion = RegionTable(ctx->GetItemLocation(location)->GetParentRegionKey());
   bool conditionsMet = false;
 
   if ((parentRegion->childDay   && CheckConditionAtAgeTime(logic->IsChild, logic->AtDay))   ||
@@ -205,7 +205,7 @@ void Region::ResetVariables() {
   }
 }
 
-std::array<Region, RR_MAX> areaTable;
+thread_local std::array<Region, RR_MAX> areaTable;
 
 bool Here(const RandomizerRegion region, ConditionFn condition) {
   return areaTable[region].Here(condition);
@@ -239,13 +239,28 @@ bool HasAccessTo(const RandomizerRegion region) {
   return areaTable[region].HasAccess();
 }
 
-Rando::Context* ctx;
-std::shared_ptr<Rando::Logic> logic;
+thread_local Rando::Context* ctx;
+thread_local std::shared_ptr<Rando::Logic> logic;
+thread_local ConditionRules conditionRules = ConditionRules::Unresolved;
+
+void ResolveConditionRules() {
+  auto& logicRules = Rando::Context::GetInstance()->GetOption(RSK_LOGIC_RULES);
+  if (logicRules.Is(RO_LOGIC_NO_LOGIC) || logicRules.Is(RO_LOGIC_VANILLA)) {
+    conditionRules = ConditionRules::NoConditions;
+  } else if (logicRules.Is(RO_LOGIC_GLITCHLESS)) {
+    conditionRules = ConditionRules::Glitchless;
+  } else if (logicRules.Is(RO_LOGIC_GLITCHED)) {
+    conditionRules = ConditionRules::Glitched;
+  } else {
+    conditionRules = ConditionRules::Unresolved;
+  }
+}
 
 void RegionTable_Init() {
   using namespace Rando;
   ctx = Context::GetInstance().get();
   logic = ctx->GetLogic(); //RANDOTODO do not hardcode, instead allow accepting a Logic class somehow
+  ResolveConditionRules();
   grottoEvents = {
       EventAccess(&logic->GossipStoneFairy, { [] { return logic->CallGossipFairy(); } }),
       EventAccess(&logic->ButterflyFairy, { [] { return logic->ButterflyFairy || (logic->CanUse(RG_STICKS)); } }),
@@ -405,15 +420,14 @@ namespace Regions {
   const auto GetAllRegions() {
     static const size_t regionCount = RR_MAX - (RR_NONE + 1);
 
-    static std::array<RandomizerRegion, regionCount> allRegions = {};
-
-    static bool intialized = false;
-    if (!intialized) {
+    // Function-local statics are initialized once even when several generation threads get here together
+    static const std::array<RandomizerRegion, regionCount> allRegions = [] {
+      std::array<RandomizerRegion, regionCount> regions = {};
       for (size_t i = 0; i < regionCount; i++) {
-        allRegions[i] = (RandomizerRegion)((RR_NONE + 1) + i);
+        regions[i] = (RandomizerRegion)((RR_NONE + 1) + i);
       }
-      intialized = true;
-    }
+      return regions;
+    }();
 
     return allRegions;
   }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <string>
 #include <vector>
 #include <list>
@@ -12,34 +13,50 @@
 typedef bool (*ConditionFn)();
 
 // I hate this but every alternative I can think of right now is worse
-extern Rando::Context* ctx;
-extern std::shared_ptr<Rando::Logic> logic;
+extern thread_local Rando::Context* ctx;
+extern thread_local std::shared_ptr<Rando::Logic> logic;
+
+//Which condition functions apply under the current RSK_LOGIC_RULES. This is resolved once per search
+//by ResolveConditionRules, so checking a condition doesn't look the option up every time.
+enum class ConditionRules : uint8_t {
+  Unresolved,
+  NoConditions,
+  Glitchless,
+  Glitched,
+};
+
+extern thread_local ConditionRules conditionRules;
+void ResolveConditionRules();
+
+//conditions[0] is the glitchless condition, conditions[1] the optional glitched one
+inline bool CheckConditions(const std::array<ConditionFn, 2>& conditions) {
+  if (conditionRules == ConditionRules::Unresolved) {
+    ResolveConditionRules();
+  }
+  switch (conditionRules) {
+    case ConditionRules::NoConditions:
+      return true;
+    case ConditionRules::Glitchless:
+      return conditions[0]();
+    case ConditionRules::Glitched:
+      return conditions[0]() || (conditions[1] != NULL && conditions[1]());
+    default:
+      return false;
+  }
+}
 
 class EventAccess {
 public:
 
   explicit EventAccess(bool* event_, std::vector<ConditionFn> conditions_met_)
-    : event(event_) {
-    conditions_met.resize(2);
+    : event(event_), conditions_met({}) {
     for (size_t i = 0; i < conditions_met_.size(); i++) {
       conditions_met[i] = conditions_met_[i];
     }
   }
 
   bool ConditionsMet() const {
-    auto ctx = Rando::Context::GetInstance();
-    if (ctx->GetOption(RSK_LOGIC_RULES).Is(RO_LOGIC_NO_LOGIC) || ctx->GetOption(RSK_LOGIC_RULES).Is(RO_LOGIC_VANILLA)) {
-      return true;
-    } else if (ctx->GetOption(RSK_LOGIC_RULES).Is(RO_LOGIC_GLITCHLESS)) {
-      return conditions_met[0]();
-    } else if (ctx->GetOption(RSK_LOGIC_RULES).Is(RO_LOGIC_GLITCHED)) {
-      if (conditions_met[0]()) {
-        return true;
-      } else if (conditions_met[1] != NULL) {
-        return conditions_met[1]();
-      }
-    }
-    return false;
+    return CheckConditions(conditions_met);
   }
 
   bool CheckConditionAtAgeTime(bool& age, bool& time) {
@@ -65,7 +82,7 @@ public:
 
 private:
   bool* event;
-  std::vector<ConditionFn> conditions_met;
+  std::array<ConditionFn, 2> conditions_met;
 };
 
 std::string CleanCheckConditionString(std::string condition);
@@ -77,35 +94,21 @@ class LocationAccess {
 public:
 
   explicit LocationAccess(RandomizerCheck location_, std::vector<ConditionFn> conditions_met_)
-    : location(location_), condition_str("") {
-    conditions_met.resize(2);
+    : location(location_), conditions_met({}), condition_str("") {
     for (size_t i = 0; i < conditions_met_.size(); i++) {
       conditions_met[i] = conditions_met_[i];
     }
   }
 
   explicit LocationAccess(RandomizerCheck location_, std::vector<ConditionFn> conditions_met_, std::string condition_str_)
-    : location(location_), condition_str(condition_str_) {
-    conditions_met.resize(2);
+    : location(location_), conditions_met({}), condition_str(condition_str_) {
     for (size_t i = 0; i < conditions_met_.size(); i++) {
       conditions_met[i] = conditions_met_[i];
     }
   }
 
   bool GetConditionsMet() const {
-    auto ctx = Rando::Context::GetInstance();
-    if (ctx->GetOption(RSK_LOGIC_RULES).Is(RO_LOGIC_NO_LOGIC) || ctx->GetOption(RSK_LOGIC_RULES).Is(RO_LOGIC_VANILLA)) {
-      return true;
-    } else if (ctx->GetOption(RSK_LOGIC_RULES).Is(RO_LOGIC_GLITCHLESS)) {
-      return conditions_met[0]();
-    } else if (ctx->GetOption(RSK_LOGIC_RULES).Is(RO_LOGIC_GLITCHED)) {
-      if (conditions_met[0]()) {
-        return true;
-      } else if (conditions_met[1] != NULL) {
-        return conditions_met[1]();
-      }
-    }
-    return false;
+    return CheckConditions(conditions_met);
   }
 
   bool CheckConditionAtAgeTime(bool& age, bool& time) const;
@@ -122,7 +125,7 @@ public:
 
 protected:
     RandomizerCheck location;
-    std::vector<ConditionFn> conditions_met;
+    std::array<ConditionFn, 2> conditions_met;
     std::string condition_str;
 
     //Makes sure shop locations are buyable
@@ -325,8 +328,10 @@ RandomizerArea GetFirstArea() const{
   }
 };
 
-extern std::array<Region, RR_MAX> areaTable;
-extern std::vector<EventAccess> grottoEvents;
+// The world graph is owned by the thread generating the seed, so that each worker
+// thread in a multi-seed batch searches its own copy.
+extern thread_local std::array<Region, RR_MAX> areaTable;
+extern thread_local std::vector<EventAccess> grottoEvents;
 
 bool Here(const RandomizerRegion region, ConditionFn condition); //RANDOTODO make a less stupid way to check own at either age than self referncing with this
 bool MQSpiritSharedStatueRoom(const RandomizerRegion region, ConditionFn condition, bool anyAge = false); 
@@ -10,6 +10,8 @@
 #include "randomizer.hpp"
 #include "spoiler_log.hpp"
 #include "location_access.hpp"
+#include "random.hpp"
+#include "../entrance.h"
 #include "soh/Enhancements/debugger/performanceTimer.h"
 #include <spdlog/spdlog.h>
 #include "../../randomizer/randomizerTypes.h"
@@ -26,12 +28,12 @@ bool GenerateRandomizer(std::set<RandomizerCheck> excludedLocations, std::set<Ra
     std::string seedInput) {
     const auto ctx = Rando::Context::GetInstance();
     ResetPerformanceTimers();
+    ctx->GetEntranceShuffler()->ResetPlacementAttempts();
     StartPerformanceTimer(PT_WHOLE_SEED);
 
-    srand(time(NULL));
     // if a blank seed was entered, make a random one
     if (seedInput.empty()) {
-        seedInput = std::to_string(rand() % 0xFFFFFFFF);
+        seedInput = std::to_string(RandomSeedValue());
     } else if (seedInput.rfind("seed_testing_count", 0) == 0 && seedInput.length() > 18) {
         int count;
         try {
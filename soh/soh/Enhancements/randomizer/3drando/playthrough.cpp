@@ -102,7 +102,7 @@ int Playthrough_Repeat(std::set<RandomizerCheck> excludedLocations, std::set<Ran
     auto ctx = Rando::Context::GetInstance();
     uint32_t repeatedSeed = 0;
     for (int i = 0; i < count; i++) {
-        ctx->GetSettings()->SetSeedString(std::to_string(rand() % 0xFFFFFFFF));
+        ctx->GetSettings()->SetSeedString(std::to_string(RandomSeedValue()));
         repeatedSeed = boost::hash_32<std::string>{}(ctx->GetSettings()->GetSeedString());
         ctx->GetSettings()->SetSeed(repeatedSeed % 0xFFFFFFFF);
         //CitraPrint("testing seed: " + std::to_string(Settings::seed));
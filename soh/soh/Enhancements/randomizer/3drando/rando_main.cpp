@@ -10,6 +10,11 @@
 #include <libultraship/libultra/types.h>
 #include "soh/OTRGlobals.h"
 #include "soh/cvar_prefixes.h"
+#include "../settings.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
 
 void RandoMain::GenerateRando(std::set<RandomizerCheck> excludedLocations, std::set<RandomizerTrick> enabledTricks,
     std::string seedString) {
@@ -22,3 +27,42 @@ void RandoMain::GenerateRando(std::set<RandomizerCheck> excludedLocations, std::
     Ship::Context::GetInstance()->GetWindow()->GetGui()->SaveConsoleVariablesOnNextTick();
     Rando::Context::GetInstance()->SetPlandoLoaded(false);
 }
+
+uint32_t RandoMain::GenerateRandoBatch(const std::vector<std::string>& seedInputs, std::set<RandomizerCheck> excludedLocations,
+                                       std::set<RandomizerTrick> enabledTricks, uint32_t threadCount,
+                                       std::function<void(size_t seedIndex, bool success)> onSeedGenerated) {
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    threadCount = static_cast<uint32_t>(std::min<size_t>(threadCount, seedInputs.size()));
+
+    // Read the CVars once here, the workers copy this snapshot instead of all reading the CVar store at once
+    Rando::Settings settingsSnapshot;
+    settingsSnapshot.CreateOptions();
+    settingsSnapshot.SetAllFromCVar();
+
+    std::atomic<size_t> nextSeed = 0;
+    std::atomic<uint32_t> generatedCount = 0;
+    std::vector<std::thread> workers;
+    for (uint32_t i = 0; i < threadCount; i++) {
+        workers.emplace_back([&]() {
+            for (size_t seedIndex = nextSeed++; seedIndex < seedInputs.size(); seedIndex = nextSeed++) {
+                auto ctx = Rando::Context::CreateThreadInstance();
+                ctx->GetSettings()->SetAllFromSettings(settingsSnapshot);
+                bool success = GenerateRandomizer(excludedLocations, enabledTricks, seedInputs[seedIndex]);
+                if (success) {
+                    generatedCount++;
+                }
+                if (onSeedGenerated != nullptr) {
+                    onSeedGenerated(seedIndex, success);
+                }
+                Rando::Context::ReleaseThreadInstance();
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    return generatedCount;
+}
@@ -1,7 +1,14 @@
 #pragma once
 #include "soh/Enhancements/randomizer/item.h"
 
+#include <functional>
 #include <set>
+#include <vector>
 namespace RandoMain {
 void GenerateRando(std::set<RandomizerCheck> excludedLocations, std::set<RandomizerTrick> enabledTricks, std::string seedInput);
+// Generates every seed in seedInputs on a pool of threadCount workers (0 uses every core), each with its own
+// Context. onSeedGenerated is called on the worker thread while that seed's Context is still current.
+uint32_t GenerateRandoBatch(const std::vector<std::string>& seedInputs, std::set<RandomizerCheck> excludedLocations,
+                            std::set<RandomizerTrick> enabledTricks, uint32_t threadCount = 0,
+                            std::function<void(size_t seedIndex, bool success)> onSeedGenerated = nullptr);
 }
@@ -1,12 +1,15 @@
 #include "random.hpp"
 
+#include <ctime>
 #include <random>
 #include <boost/random/mersenne_twister.hpp>
 #include <boost/random/uniform_int_distribution.hpp>
 #include <boost/random/uniform_real_distribution.hpp>
 
-static bool init = false;
-static boost::random::mt19937 generator;
+// Each thread owns its own generator so that seeds generated in parallel
+// (see Rando::Context::CreateThreadInstance) don't share RNG state.
+static thread_local bool init = false;
+static thread_local boost::random::mt19937 generator;
 
 //Initialize with seed specified
 void Random_Init(uint32_t seed) {
@@ -29,6 +32,17 @@ uint32_t Random(int min, int max) {
     return distribution(generator);
 }
 
+//Returns a fresh value to build a seed from when none was entered, without touching the seeded generator.
+//Each thread draws from its own source, so seeds generated in parallel never share one
+uint32_t RandomSeedValue() {
+#if !defined(__SWITCH__) && !defined(__WIIU__)
+    return static_cast<uint32_t>(std::random_device{}());
+#else
+    static thread_local boost::random::mt19937 seedGenerator{ static_cast<uint32_t>(time(NULL)) };
+    return seedGenerator();
+#endif
+}
+
 //Returns a random floating point number in [0.0, 1.0]
 double RandomDouble() {
     boost::random::uniform_real_distribution<double> distribution(0.0, 1.0);
@@ -9,6 +9,7 @@
 
 void Random_Init(uint32_t seed);
 uint32_t Random(int min, int max);
+uint32_t RandomSeedValue();
 double RandomDouble();
 
 //Get a random element from a vector or array
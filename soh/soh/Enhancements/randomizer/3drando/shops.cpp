@@ -7,6 +7,7 @@
 #include <array>
 #include <math.h>
 #include <map>
+#include <mutex>
 #include <spdlog/spdlog.h>
 #include "z64item.h"
 
@@ -34,7 +35,7 @@ PriceSettingsStruct::PriceSettingsStruct(RandomizerSettingKey _main,
 
 
 static std::array<std::vector<Text>, 0xF1> trickNameTable; // Table of trick names for ice traps
-bool initTrickNames = false; //Indicates if trick ice trap names have been initialized yet
+static std::once_flag trickNamesInitialized; //Seeds generated in parallel can all ask for a name first
 
 //Set vanilla shop item locations before potentially shuffling
 void PlaceVanillaShopItems() {
@@ -1125,10 +1126,7 @@ void InitTrickNames() {
 //Generate a fake name for the ice trap based on the item it's displayed as
 Text GetIceTrapName(uint8_t id) {
     //If the trick names table has not been initialized, do so
-    if (!initTrickNames) {
-        InitTrickNames();
-        initTrickNames = true;
-    }
+    std::call_once(trickNamesInitialized, InitTrickNames);
     //Randomly get the easy, medium, or hard name for the given item id
     return RandomElement(trickNameTable[id]);
 }
\ No newline at end of file
@@ -35,14 +35,14 @@
 using json = nlohmann::ordered_json;
 using namespace Rando;
 
-json jsonData;
-std::map<RandomizerHintTextKey, Rando::ItemLocation*> hintedLocations;
+thread_local json jsonData;
+thread_local std::map<RandomizerHintTextKey, Rando::ItemLocation*> hintedLocations;
 
 extern std::array<std::string, 17> hintCategoryNames;
 extern Region* GetHintRegion(uint32_t);
 
 namespace {
-std::string placementtxt;
+thread_local std::string placementtxt;
 } // namespace
 
 void GenerateHash() {
@@ -449,7 +449,10 @@ const char* SpoilerLog_Write() {
     jsonFile << std::setw(4) << jsonString << std::endl;
     jsonFile.close();
 
-    CVarSetString(CVAR_GENERAL("SpoilerLog"), (std::string("./Randomizer/") + fileName + std::string(".json")).c_str());
+    // Seeds generated on a thread owned context are batch output, not the seed the game should load
+    if (!Rando::Context::HasThreadInstance()) {
+        CVarSetString(CVAR_GENERAL("SpoilerLog"), (std::string("./Randomizer/") + fileName + std::string(".json")).c_str());
+    }
 
     // Note: probably shouldn't return this without making sure this string is stored somewhere, but
     // this return value is currently only used in playthrough.cpp as a true/false. Even if the pointer
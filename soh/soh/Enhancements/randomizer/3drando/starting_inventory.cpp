@@ -6,8 +6,8 @@
 #include "pool_functions.hpp"
 #include "soh/Enhancements/randomizer/static_data.h"
 
-std::vector<RandomizerGet> StartingInventory;
-uint8_t AdditionalHeartContainers;
+thread_local std::vector<RandomizerGet> StartingInventory;
+thread_local uint8_t AdditionalHeartContainers;
 
 static void AddItemToInventory(RandomizerGet item, size_t count = 1) {
   StartingInventory.insert(StartingInventory.end(), count, item);
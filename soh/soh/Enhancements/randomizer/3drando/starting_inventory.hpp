@@ -5,8 +5,8 @@
 #include <vector>
 #include <stdint.h>
 
-extern std::vector<RandomizerGet> StartingInventory;
-extern uint8_t AdditionalHeartContainers;
+extern thread_local std::vector<RandomizerGet> StartingInventory;
+extern thread_local uint8_t AdditionalHeartContainers;
 
 void GenerateStartingInventory();
 bool StartingInventoryHasBottle();
@@ -18,6 +18,7 @@
 
 namespace Rando {
 std::weak_ptr<Context> Context::mContext;
+thread_local std::shared_ptr<Context> Context::mThreadContext;
 
 Context::Context() {
 
@@ -33,7 +34,12 @@ Context::Context() {
 }
 
 RandomizerArea Context::GetAreaFromString(std::string str) {
-    return (RandomizerArea)StaticData::areaNameToEnum[str];
+    // find() rather than operator[], batch workers share this map and must not insert into it
+    auto area = StaticData::areaNameToEnum.find(str);
+    if (area == StaticData::areaNameToEnum.end()) {
+        return RA_NONE;
+    }
+    return (RandomizerArea)area->second;
 }
 
 void Context::InitStaticData() {
@@ -56,9 +62,34 @@ std::shared_ptr<Context> Context::CreateInstance() {
 }
 
 std::shared_ptr<Context> Context::GetInstance() {
+    if (mThreadContext != nullptr) {
+        return mThreadContext;
+    }
     return mContext.lock();
 }
 
+std::shared_ptr<Context> Context::CreateThreadInstance() {
+    ReleaseThreadInstance();
+    mThreadContext = std::make_shared<Context>();
+    mThreadContext->GetLogic()->SetContext(mThreadContext);
+    mThreadContext->AddExcludedOptions();
+    mThreadContext->GetSettings()->CreateOptions();
+    return mThreadContext;
+}
+
+bool Context::HasThreadInstance() {
+    return mThreadContext != nullptr;
+}
+
+void Context::ReleaseThreadInstance() {
+    if (mThreadContext == nullptr) {
+        return;
+    }
+    // Logic holds a reference back to its Context, break the cycle so both are freed
+    mThreadContext->GetLogic()->SetContext(nullptr);
+    mThreadContext.reset();
+}
+
 Hint* Context::GetHint(const RandomizerHint hintKey) {
     return &hintTable[hintKey];
 }
@@ -37,6 +37,14 @@ class Context {
     Context();
     static std::shared_ptr<Context> CreateInstance();
     static std::shared_ptr<Context> GetInstance();
+    /**
+     * @brief Creates a Context owned by the calling thread. Until ReleaseThreadInstance is called,
+     * GetInstance on this thread returns it instead of the shared instance, which lets several
+     * seeds be generated at once on worker threads.
+     */
+    static std::shared_ptr<Context> CreateThreadInstance();
+    static void ReleaseThreadInstance();
+    static bool HasThreadInstance();
     void InitStaticData();
     Hint* GetHint(RandomizerHint hintKey);
     void AddHint(const RandomizerHint hintId, const Hint hint);
@@ -95,6 +103,7 @@ class Context {
 
   private:
     static std::weak_ptr<Context> mContext;
+    static thread_local std::shared_ptr<Context> mThreadContext;
     std::array<Hint, RH_MAX> hintTable = {};
     std::array<ItemLocation, RC_MAX> itemLocationTable = {};
     std::shared_ptr<Settings> mSettings;
@@ -11,9 +11,8 @@ namespace Rando {
 EntranceLinkInfo NO_RETURN_ENTRANCE = { EntranceType::None, RR_NONE, RR_NONE, -1 };
 
 Entrance::Entrance(RandomizerRegion connectedRegion_, std::vector<ConditionFn> conditions_met_, bool spreadsAreasWithPriority_)
-    : connectedRegion(connectedRegion_),  spreadsAreasWithPriority(spreadsAreasWithPriority_){
+    : connectedRegion(connectedRegion_), conditions_met({}), spreadsAreasWithPriority(spreadsAreasWithPriority_){
     originalConnectedRegion = connectedRegion_;
-    conditions_met.resize(2);
     for (size_t i = 0; i < conditions_met_.size(); i++) {
         conditions_met[i] = conditions_met_[i];
     }
@@ -24,19 +23,7 @@ void Entrance::SetCondition(ConditionFn newCondition) {
 }
 
 bool Entrance::GetConditionsMet() const {
-    auto ctx = Rando::Context::GetInstance();
-    if (ctx->GetOption(RSK_LOGIC_RULES).Is(RO_LOGIC_NO_LOGIC) || ctx->GetOption(RSK_LOGIC_RULES).Is(RO_LOGIC_VANILLA)) {
-        return true;
-    } else if (ctx->GetOption(RSK_LOGIC_RULES).Is(RO_LOGIC_GLITCHLESS)) {
-        return conditions_met[0]();
-    } else if (ctx->GetOption(RSK_LOGIC_RULES).Is(RO_LOGIC_GLITCHED)) {
-        if (conditions_met[0]()) {
-            return true;
-        } else if (conditions_met[1] != NULL) {
-            return conditions_met[1]();
-        }
-    }
-    return false;
+    return CheckConditions(conditions_met);
 }
 
 std::string Entrance::to_string() const {
@@ -72,7 +59,6 @@ void Entrance::printAgeTimeAccess() {
 }
 
 bool Entrance::ConditionsMet(bool allAgeTimes) const {
-  auto ctx = Rando::Context::GetInstance();
   StartPerformanceTimer(PT_ENTRANCE_LOGIC);
   Region* parent = RegionTable(parentRegion);
   int conditionsMet = 0;
@@ -256,6 +242,14 @@ void EntranceShuffler::SetNoRandomEntrances(bool noRandomEntrances) {
     mNoRandomEntrances = noRandomEntrances;
 }
 
+int EntranceShuffler::GetPlacementAttempts() const {
+    return mPlacementAttempts;
+}
+
+void EntranceShuffler::ResetPlacementAttempts() {
+    mPlacementAttempts = 0;
+}
+
 // Construct entrance name from parent and connected region keys
 std::string EntranceNameByRegions(RandomizerRegion parentRegion, RandomizerRegion connectedRegion) {
     return RegionTable(parentRegion)->regionName + " -> " + RegionTable(connectedRegion)->regionName;
@@ -442,6 +436,34 @@ static bool EntranceUnreachableAs(Entrance* entrance, uint8_t age, std::vector<E
     return true;
 }
 
+// Entrances the player must never take as the given age unless entrances are decoupled, keyed by the regions the
+// entrance originally linked so checking a placement doesn't need to compare names
+struct ForbiddenAgeEntrance {
+    RandomizerRegion parentRegion;
+    RandomizerRegion connectedRegion;
+    RandoOptionStartingAge age;
+};
+
+static constexpr std::array<ForbiddenAgeEntrance, 5> sForbiddenAgeEntrances = { {
+    { RR_OGC_GREAT_FAIRY_FOUNTAIN, RR_CASTLE_GROUNDS, RO_AGE_CHILD },
+    { RR_GV_CARPENTER_TENT, RR_GV_FORTRESS_SIDE, RO_AGE_CHILD },
+    { RR_GANONS_CASTLE_ENTRYWAY, RR_CASTLE_GROUNDS_FROM_GANONS_CASTLE, RO_AGE_CHILD },
+    { RR_HC_GREAT_FAIRY_FOUNTAIN, RR_CASTLE_GROUNDS, RO_AGE_ADULT },
+    { RR_HC_STORMS_GROTTO, RR_CASTLE_GROUNDS, RO_AGE_ADULT },
+} };
+
+// Returns the age the entrance must stay unreachable as, or RO_AGE_RANDOM if it has no restriction
+static RandoOptionStartingAge GetForbiddenAge(const Entrance* entrance) {
+    RandomizerRegion parentRegion = entrance->GetParentRegionKey();
+    RandomizerRegion connectedRegion = entrance->GetOriginalConnectedRegionKey();
+    for (const ForbiddenAgeEntrance& forbidden : sForbiddenAgeEntrances) {
+        if (forbidden.parentRegion == parentRegion && forbidden.connectedRegion == connectedRegion) {
+            return forbidden.age;
+        }
+    }
+    return RO_AGE_RANDOM;
+}
+
 static bool ValidateWorld(Entrance* entrancePlaced) {
     auto ctx = Rando::Context::GetInstance();
     SPDLOG_DEBUG("Validating world\n");
@@ -466,66 +488,55 @@ static bool ValidateWorld(Entrance* entrancePlaced) {
          type == EntranceType::SpecialInterior || type == EntranceType::Overworld || type == EntranceType::Spawn ||
          type == EntranceType::WarpSong || type == EntranceType::OwlDrop);
 
-    // Search the world to verify that all necessary conditions are still being held
-    // Conditions will be checked during the search and any that fail will be figured out
-    // afterwards
-    ctx->GetLogic()->Reset();
-    ValidateEntrances(checkPoeCollectorAccess, checkOtherEntranceAccess);
-
     if (!ctx->GetOption(RSK_DECOUPLED_ENTRANCES)) {
         // Unless entrances are decoupled, we don't want the player to end up through certain entrances as the wrong age
         // This means we need to hard check that none of the relevant entrances are ever reachable as that age
         // This is mostly relevant when mixing entrance pools or shuffling special interiors (such as windmill or kak
         // potion shop) Warp Songs and Overworld Spawns can also end up inside certain indoors so those need to be
         // handled as well
-        std::array<std::string, 3> childForbidden = { "OGC Great Fairy Fountain -> Castle Grounds",
-                                                      "GV Carpenter Tent -> GV Fortress Side",
-                                                      "Ganon's Castle Entryway -> Castle Grounds From Ganon's Castle" };
-        std::array<std::string, 2> adultForbidden = { "HC Great Fairy Fountain -> Castle Grounds",
-                                                      "HC Storms Grotto -> Castle Grounds" };
-
+        // These checks only walk the entrance graph, so they run before the world search and let a bad placement
+        // be rejected without searching
         auto allShuffleableEntrances = GetShuffleableEntrances(EntranceType::All, false);
         for (auto& entrance : allShuffleableEntrances) {
+            if (entrance->IsShuffled()) {
+                Entrance* replacement = entrance->GetReplacement();
+                if (replacement == nullptr) {
+                    continue;
+                }
 
-            std::vector<Entrance*> alreadyChecked = {};
+                RandoOptionStartingAge forbiddenAge = GetForbiddenAge(replacement);
+                if (forbiddenAge == RO_AGE_RANDOM) {
+                    continue;
+                }
 
-            if (entrance->IsShuffled()) {
-                if (entrance->GetReplacement() != nullptr) {
-
-                    auto replacementName = entrance->GetReplacement()->GetName();
-                    alreadyChecked.push_back(entrance->GetReplacement()->GetReverse());
-
-                    if (ElementInContainer(replacementName, childForbidden) &&
-                        !EntranceUnreachableAs(entrance, RO_AGE_CHILD, alreadyChecked)) {
-                        auto message = replacementName + " is replaced by an entrance with a potential child access\n";
-                        SPDLOG_DEBUG(message);
-                        return false;
-                    } else if (ElementInContainer(replacementName, adultForbidden) &&
-                               !EntranceUnreachableAs(entrance, RO_AGE_ADULT, alreadyChecked)) {
-                        auto message = replacementName + " is replaced by an entrance with a potential adult access\n";
-                        SPDLOG_DEBUG(message);
-                        return false;
-                    }
+                std::vector<Entrance*> alreadyChecked = { replacement->GetReverse() };
+                if (!EntranceUnreachableAs(entrance, forbiddenAge, alreadyChecked)) {
+                    SPDLOG_DEBUG("{} is replaced by an entrance with a potential {} access\n", replacement->GetName(),
+                                 forbiddenAge == RO_AGE_CHILD ? "child" : "adult");
+                    return false;
                 }
             } else {
-                auto name = entrance->GetName();
-                alreadyChecked.push_back(entrance->GetReverse());
+                RandoOptionStartingAge forbiddenAge = GetForbiddenAge(entrance);
+                if (forbiddenAge == RO_AGE_RANDOM) {
+                    continue;
+                }
 
-                if (ElementInContainer(name, childForbidden) &&
-                    !EntranceUnreachableAs(entrance, RO_AGE_CHILD, alreadyChecked)) {
-                    auto message = name + " is potentially accessible as child\n";
-                    SPDLOG_DEBUG(message);
-                    return false;
-                } else if (ElementInContainer(name, adultForbidden) &&
-                           !EntranceUnreachableAs(entrance, RO_AGE_ADULT, alreadyChecked)) {
-                    auto message = name + " is potentially accessible as adult\n";
-                    SPDLOG_DEBUG(message);
+                std::vector<Entrance*> alreadyChecked = { entrance->GetReverse() };
+                if (!EntranceUnreachableAs(entrance, forbiddenAge, alreadyChecked)) {
+                    SPDLOG_DEBUG("{} is potentially accessible as {}\n", entrance->GetName(),
+                                 forbiddenAge == RO_AGE_CHILD ? "child" : "adult");
                     return false;
                 }
             }
         }
     }
 
+    // Search the world to verify that all necessary conditions are still being held
+    // Conditions will be checked during the search and any that fail will be figured out
+    // afterwards
+    ctx->GetLogic()->Reset();
+    ValidateEntrances(checkPoeCollectorAccess, checkOtherEntranceAccess);
+
     // If all locations aren't reachable, that means that one of the conditions failed when searching
     if (!Rando::Context::GetInstance()->allLocationsReachable) {
         if (checkOtherEntranceAccess) {
@@ -599,6 +610,7 @@ static void ConfirmReplacement(Entrance* entrance, Entrance* targetEntrance) {
 }
 
 bool EntranceShuffler::ReplaceEntrance(Entrance* entrance, Entrance* target, std::vector<EntrancePair>& rollbacks) {
+    mPlacementAttempts++;
 
     if (!AreEntrancesCompatible(entrance, target, rollbacks)) {
         return false;
@@ -83,7 +83,7 @@ class Entrance {
     RandomizerRegion parentRegion;
     RandomizerRegion connectedRegion;
     RandomizerRegion originalConnectedRegion;
-    std::vector<ConditionFn> conditions_met;
+    std::array<ConditionFn, 2> conditions_met;
 
     EntranceType type = EntranceType::None;
     Entrance* target = nullptr;
@@ -128,6 +128,10 @@ class EntranceShuffler {
     void CreateEntranceOverrides();
     void UnshuffleAllEntrances();
     void ParseJson(nlohmann::json spoilerFileJson);
+    // Number of placements tried since the last reset, whether or not they were kept. Fill retries keep adding to
+    // it, the same way they keep adding to the entrance shuffle timer.
+    int GetPlacementAttempts() const;
+    void ResetPlacementAttempts();
   private:
     std::vector<Entrance*> AssumeEntrancePool(std::vector<Entrance*>& entrancePool);
     bool ShuffleOneWayPriorityEntrances(std::map<std::string, PriorityEntrance>& oneWayPriorities,
@@ -144,6 +148,7 @@ class EntranceShuffler {
     bool mNoRandomEntrances;
     int mTotalRandomizableEntrances = 0;
     int mCurNumRandomizedEntrances = 0;
+    int mPlacementAttempts = 0;
     bool mEntranceShuffleFailure = false;
 };
 } // namespace Rando
@@ -86,10 +86,10 @@ Hint::Hint(RandomizerHint ownKey_, nlohmann::json json_){
 
   if (json_.contains("areas")){
     for (auto area: json_["areas"]){
-      areas.push_back((RandomizerArea)Rando::StaticData::areaNameToEnum[area]);
+      areas.push_back(Rando::Context::GetInstance()->GetAreaFromString(area.get<std::string>()));
     }
   } else if (json_.contains("area")){
-    areas.push_back((RandomizerArea)Rando::StaticData::areaNameToEnum[json_["area"]]);
+    areas.push_back(Rando::Context::GetInstance()->GetAreaFromString(json_["area"].get<std::string>()));
   }
 
   if (json_.contains("areaNamesChosen")){
@@ -3,10 +3,122 @@
 #include "context.h"
 #include "dungeon.h"
 
+#include <algorithm>
+#include <bit>
+
 #define TWO_ACTOR_PARAMS(a, b) (abs(a) << 16) | abs(b)
 
 std::array<Rando::Location, RC_MAX> Rando::StaticData::locationTable;
-std::multimap<std::tuple<s16, s16, s32>, RandomizerCheck> Rando::StaticData::CheckFromActorMultimap;
+
+// Checks keyed on the actor, scene and params that identify them. Each entry holds the check for every
+// quest and age combination, indexed by ActorCheckSlot, so a lookup never has to inspect the locations
+typedef std::array<RandomizerCheck, 4> ActorCheckSlots;
+
+static std::unordered_map<uint64_t, ActorCheckSlots> sCheckFromActorIndex;
+
+static uint64_t ActorCheckKey(s16 actorId, s16 sceneNum, s32 actorParams) {
+    return ((uint64_t)(uint16_t)actorId << 48) | ((uint64_t)(uint16_t)sceneNum << 32) | (uint32_t)actorParams;
+}
+
+static size_t ActorCheckSlot(bool isMQ, bool isAdult) {
+    return isMQ * 2 + isAdult;
+}
+
+typedef enum {
+    ACTOR_CHECK_ANY_AGE,
+    ACTOR_CHECK_CHILD,
+    ACTOR_CHECK_ADULT,
+} ActorCheckAge;
+
+// Fills the slots a check applies to, keeping whatever an earlier entry for the same key put there
+static void AddActorCheck(ActorCheckSlots& slots, RandomizerCheckQuest quest, ActorCheckAge age, RandomizerCheck rc) {
+    for (bool isMQ : { false, true }) {
+        if ((quest == RCQUEST_VANILLA && isMQ) || (quest == RCQUEST_MQ && !isMQ)) {
+            continue;
+        }
+        for (bool isAdult : { false, true }) {
+            if ((age == ACTOR_CHECK_CHILD && isAdult) || (age == ACTOR_CHECK_ADULT && !isAdult)) {
+                continue;
+            }
+            RandomizerCheck& slot = slots[ActorCheckSlot(isMQ, isAdult)];
+            if (slot == RC_UNKNOWN_CHECK) {
+                slot = rc;
+            }
+        }
+    }
+}
+
+#define ACTOR_CHECK_ANY_ACTOR -1
+#define ACTOR_CHECK_ANY_PARAMS 0
+#define ACTOR_CHECK_EXACT_PARAMS -1
+
+// Checks that can't be identified by their location's actor, scene and params alone. An actor matches a rule when
+// (actorParams & paramsMask) == actorParams of the rule. These take priority over the location table.
+typedef struct {
+    s16 actorId;
+    s16 sceneNum;
+    s32 actorParams;
+    s32 paramsMask;
+    RandomizerCheckQuest quest;
+    ActorCheckAge age;
+    RandomizerCheck rc;
+} ActorCheckRule;
+
+static const ActorCheckRule sActorCheckRules[] = {
+    // The treasure chest game's chests are told apart by the room bits of their params, with the key flag above
+    { ACTOR_EN_BOX,          SCENE_TREASURE_BOX_SHOP,             20170, ACTOR_CHECK_EXACT_PARAMS, RCQUEST_BOTH, ACTOR_CHECK_ANY_AGE, RC_MARKET_TREASURE_CHEST_GAME_REWARD },
+    { ACTOR_ITEM_ETCETERA,   SCENE_TREASURE_BOX_SHOP,              2572, ACTOR_CHECK_EXACT_PARAMS, RCQUEST_BOTH, ACTOR_CHECK_ANY_AGE, RC_MARKET_TREASURE_CHEST_GAME_REWARD },
+    { ACTOR_EN_BOX,          SCENE_TREASURE_BOX_SHOP,              0x20,                     0x6E, RCQUEST_BOTH, ACTOR_CHECK_ANY_AGE, RC_MARKET_TREASURE_CHEST_GAME_KEY_1 },
+    { ACTOR_EN_BOX,          SCENE_TREASURE_BOX_SHOP,              0x22,                     0x6E, RCQUEST_BOTH, ACTOR_CHECK_ANY_AGE, RC_MARKET_TREASURE_CHEST_GAME_KEY_2 },
+    { ACTOR_EN_BOX,          SCENE_TREASURE_BOX_SHOP,              0x24,                     0x6E, RCQUEST_BOTH, ACTOR_CHECK_ANY_AGE, RC_MARKET_TREASURE_CHEST_GAME_KEY_3 },
+    { ACTOR_EN_BOX,          SCENE_TREASURE_BOX_SHOP,              0x26,                     0x6E, RCQUEST_BOTH, ACTOR_CHECK_ANY_AGE, RC_MARKET_TREASURE_CHEST_GAME_KEY_4 },
+    { ACTOR_EN_BOX,          SCENE_TREASURE_BOX_SHOP,              0x28,                     0x6E, RCQUEST_BOTH, ACTOR_CHECK_ANY_AGE, RC_MARKET_TREASURE_CHEST_GAME_KEY_5 },
+    { ACTOR_EN_BOX,          SCENE_TREASURE_BOX_SHOP,              0x00,                     0x0E, RCQUEST_BOTH, ACTOR_CHECK_ANY_AGE, RC_MARKET_TREASURE_CHEST_GAME_ITEM_1 },
+    { ACTOR_EN_BOX,          SCENE_TREASURE_BOX_SHOP,              0x02,                     0x0E, RCQUEST_BOTH, ACTOR_CHECK_ANY_AGE, RC_MARKET_TREASURE_CHEST_GAME_ITEM_2 },
+    { ACTOR_EN_BOX,          SCENE_TREASURE_BOX_SHOP,              0x04,                     0x0E, RCQUEST_BOTH, ACTOR_CHECK_ANY_AGE, RC_MARKET_TREASURE_CHEST_GAME_ITEM_3 },
+    { ACTOR_EN_BOX,          SCENE_TREASURE_BOX_SHOP,              0x06,                     0x0E, RCQUEST_BOTH, ACTOR_CHECK_ANY_AGE, RC_MARKET_TREASURE_CHEST_GAME_ITEM_4 },
+    { ACTOR_EN_BOX,          SCENE_TREASURE_BOX_SHOP,              0x08,                     0x0E, RCQUEST_BOTH, ACTOR_CHECK_ANY_AGE, RC_MARKET_TREASURE_CHEST_GAME_ITEM_5 },
+    { ACTOR_EN_SA,           SCENE_SACRED_FOREST_MEADOW,         ACTOR_CHECK_ANY_PARAMS,   ACTOR_CHECK_ANY_PARAMS, RCQUEST_BOTH, ACTOR_CHECK_ANY_AGE, RC_SONG_FROM_SARIA },
+    // Gossip stones outside the Temple of Time and in Zora's Fountain, which share params across scenes
+    { ACTOR_CHECK_ANY_ACTOR, SCENE_TEMPLE_OF_TIME_EXTERIOR_DAY,   14342, ACTOR_CHECK_EXACT_PARAMS, RCQUEST_BOTH, ACTOR_CHECK_ANY_AGE, RC_TOT_LEFTMOST_GOSSIP_STONE },
+    { ACTOR_CHECK_ANY_ACTOR, SCENE_TEMPLE_OF_TIME_EXTERIOR_DAY,   14599, ACTOR_CHECK_EXACT_PARAMS, RCQUEST_BOTH, ACTOR_CHECK_ANY_AGE, RC_TOT_LEFT_CENTER_GOSSIP_STONE },
+    { ACTOR_CHECK_ANY_ACTOR, SCENE_TEMPLE_OF_TIME_EXTERIOR_DAY,   14862, ACTOR_CHECK_EXACT_PARAMS, RCQUEST_BOTH, ACTOR_CHECK_ANY_AGE, RC_TOT_RIGHT_CENTER_GOSSIP_STONE },
+    { ACTOR_CHECK_ANY_ACTOR, SCENE_TEMPLE_OF_TIME_EXTERIOR_DAY,   15120, ACTOR_CHECK_EXACT_PARAMS, RCQUEST_BOTH, ACTOR_CHECK_ANY_AGE, RC_TOT_RIGHTMOST_GOSSIP_STONE },
+    { ACTOR_CHECK_ANY_ACTOR, SCENE_TEMPLE_OF_TIME_EXTERIOR_NIGHT, 14342, ACTOR_CHECK_EXACT_PARAMS, RCQUEST_BOTH, ACTOR_CHECK_ANY_AGE, RC_TOT_LEFTMOST_GOSSIP_STONE },
+    { ACTOR_CHECK_ANY_ACTOR, SCENE_TEMPLE_OF_TIME_EXTERIOR_NIGHT, 14599, ACTOR_CHECK_EXACT_PARAMS, RCQUEST_BOTH, ACTOR_CHECK_ANY_AGE, RC_TOT_LEFT_CENTER_GOSSIP_STONE },
+    { ACTOR_CHECK_ANY_ACTOR, SCENE_TEMPLE_OF_TIME_EXTERIOR_NIGHT, 14862, ACTOR_CHECK_EXACT_PARAMS, RCQUEST_BOTH, ACTOR_CHECK_ANY_AGE, RC_TOT_RIGHT_CENTER_GOSSIP_STONE },
+    { ACTOR_CHECK_ANY_ACTOR, SCENE_TEMPLE_OF_TIME_EXTERIOR_NIGHT, 15120, ACTOR_CHECK_EXACT_PARAMS, RCQUEST_BOTH, ACTOR_CHECK_ANY_AGE, RC_TOT_RIGHTMOST_GOSSIP_STONE },
+    { ACTOR_CHECK_ANY_ACTOR, SCENE_TEMPLE_OF_TIME_EXTERIOR_RUINS, 14342, ACTOR_CHECK_EXACT_PARAMS, RCQUEST_BOTH, ACTOR_CHECK_ANY_AGE, RC_TOT_LEFTMOST_GOSSIP_STONE },
+    { ACTOR_CHECK_ANY_ACTOR, SCENE_TEMPLE_OF_TIME_EXTERIOR_RUINS, 14599, ACTOR_CHECK_EXACT_PARAMS, RCQUEST_BOTH, ACTOR_CHECK_ANY_AGE, RC_TOT_LEFT_CENTER_GOSSIP_STONE },
+    { ACTOR_CHECK_ANY_ACTOR, SCENE_TEMPLE_OF_TIME_EXTERIOR_RUINS, 14862, ACTOR_CHECK_EXACT_PARAMS, RCQUEST_BOTH, ACTOR_CHECK_ANY_AGE, RC_TOT_RIGHT_CENTER_GOSSIP_STONE },
+    { ACTOR_CHECK_ANY_ACTOR, SCENE_TEMPLE_OF_TIME_EXTERIOR_RUINS, 15120, ACTOR_CHECK_EXACT_PARAMS, RCQUEST_BOTH, ACTOR_CHECK_ANY_AGE, RC_TOT_RIGHTMOST_GOSSIP_STONE },
+    { ACTOR_CHECK_ANY_ACTOR, SCENE_ZORAS_FOUNTAIN,                15362, ACTOR_CHECK_EXACT_PARAMS, RCQUEST_BOTH, ACTOR_CHECK_ANY_AGE, RC_ZF_JABU_GOSSIP_STONE },
+    { ACTOR_CHECK_ANY_ACTOR, SCENE_ZORAS_FOUNTAIN,                14594, ACTOR_CHECK_EXACT_PARAMS, RCQUEST_BOTH, ACTOR_CHECK_ANY_AGE, RC_ZF_JABU_GOSSIP_STONE },
+    { ACTOR_CHECK_ANY_ACTOR, SCENE_ZORAS_FOUNTAIN,                14849, ACTOR_CHECK_EXACT_PARAMS, RCQUEST_BOTH, ACTOR_CHECK_ANY_AGE, RC_ZF_FAIRY_GOSSIP_STONE },
+    { ACTOR_CHECK_ANY_ACTOR, SCENE_ZORAS_FOUNTAIN,                14337, ACTOR_CHECK_EXACT_PARAMS, RCQUEST_BOTH, ACTOR_CHECK_ANY_AGE, RC_ZF_FAIRY_GOSSIP_STONE },
+    // Actor params are used to differentiate between textboxes
+    { ACTOR_EN_SSH,          SCENE_HOUSE_OF_SKULLTULA,                1, ACTOR_CHECK_EXACT_PARAMS, RCQUEST_BOTH, ACTOR_CHECK_ANY_AGE, RC_KAK_10_GOLD_SKULLTULA_REWARD },
+    { ACTOR_EN_SSH,          SCENE_HOUSE_OF_SKULLTULA,                2, ACTOR_CHECK_EXACT_PARAMS, RCQUEST_BOTH, ACTOR_CHECK_ANY_AGE, RC_KAK_20_GOLD_SKULLTULA_REWARD },
+    { ACTOR_EN_SSH,          SCENE_HOUSE_OF_SKULLTULA,                3, ACTOR_CHECK_EXACT_PARAMS, RCQUEST_BOTH, ACTOR_CHECK_ANY_AGE, RC_KAK_30_GOLD_SKULLTULA_REWARD },
+    { ACTOR_EN_SSH,          SCENE_HOUSE_OF_SKULLTULA,                4, ACTOR_CHECK_EXACT_PARAMS, RCQUEST_BOTH, ACTOR_CHECK_ANY_AGE, RC_KAK_40_GOLD_SKULLTULA_REWARD },
+    { ACTOR_EN_SSH,          SCENE_HOUSE_OF_SKULLTULA,                5, ACTOR_CHECK_EXACT_PARAMS, RCQUEST_BOTH, ACTOR_CHECK_ANY_AGE, RC_KAK_50_GOLD_SKULLTULA_REWARD },
+    { ACTOR_EN_NIW_LADY,     SCENE_KAKARIKO_VILLAGE,             ACTOR_CHECK_ANY_PARAMS,   ACTOR_CHECK_ANY_PARAMS, RCQUEST_BOTH, ACTOR_CHECK_CHILD,   RC_KAK_ANJU_AS_CHILD },
+    { ACTOR_EN_NIW_LADY,     SCENE_KAKARIKO_VILLAGE,             ACTOR_CHECK_ANY_PARAMS,   ACTOR_CHECK_ANY_PARAMS, RCQUEST_BOTH, ACTOR_CHECK_ADULT,   RC_KAK_ANJU_AS_ADULT },
+    { ACTOR_ITEM_ETCETERA,   SCENE_LAKE_HYLIA,                   ACTOR_CHECK_ANY_PARAMS,   ACTOR_CHECK_ANY_PARAMS, RCQUEST_BOTH, ACTOR_CHECK_CHILD,   RC_LH_UNDERWATER_ITEM },
+    { ACTOR_ITEM_ETCETERA,   SCENE_LAKE_HYLIA,                   ACTOR_CHECK_ANY_PARAMS,   ACTOR_CHECK_ANY_PARAMS, RCQUEST_BOTH, ACTOR_CHECK_ADULT,   RC_LH_SUN },
+    // GF chest as child has different params and gives odd mushroom, set it to the GF chest check for both ages
+    { ACTOR_EN_BOX,          SCENE_GERUDOS_FORTRESS,             ACTOR_CHECK_ANY_PARAMS,   ACTOR_CHECK_ANY_PARAMS, RCQUEST_BOTH, ACTOR_CHECK_ANY_AGE, RC_GF_CHEST },
+    { ACTOR_EN_GS,           SCENE_DODONGOS_CAVERN,               15892, ACTOR_CHECK_EXACT_PARAMS, RCQUEST_MQ,   ACTOR_CHECK_ANY_AGE, RC_DODONGOS_CAVERN_GOSSIP_STONE },
+};
+
+// The rules grouped by which actors and which bits of the params they match on, most specific first
+typedef struct {
+    bool anyActor;
+    s32 paramsMask;
+    std::unordered_map<uint64_t, ActorCheckSlots> checks;
+} ActorCheckRuleShape;
+
+static std::vector<ActorCheckRuleShape> sActorCheckRuleShapes;
 
 std::vector<RandomizerCheck> Rando::StaticData::dungeonRewardLocations = {
     // Bosses
@@ -1100,8 +1212,62 @@ void Rando::StaticData::InitLocationTable() { //
 
     for (auto& location : locationTable) {
         locationNameToEnum[location.GetName()] = location.GetRandomizerCheck();
-        CheckFromActorMultimap.emplace(std::make_tuple((int16_t)location.GetActorID(), (int16_t)location.GetScene(), location.GetActorParams()), location.GetRandomizerCheck());
     }
+
+    InitCheckFromActorIndex();
+}
+
+void Rando::StaticData::InitCheckFromActorIndex() {
+    sActorCheckRuleShapes.clear();
+    for (const ActorCheckRule& rule : sActorCheckRules) {
+        bool anyActor = rule.actorId == ACTOR_CHECK_ANY_ACTOR;
+        auto shape = std::find_if(sActorCheckRuleShapes.begin(), sActorCheckRuleShapes.end(),
+                                  [&](const ActorCheckRuleShape& shape) {
+                                      return shape.anyActor == anyActor && shape.paramsMask == rule.paramsMask;
+                                  });
+        if (shape == sActorCheckRuleShapes.end()) {
+            shape = sActorCheckRuleShapes.insert(sActorCheckRuleShapes.end(), { anyActor, rule.paramsMask, {} });
+        }
+
+        auto [slots, inserted] = shape->checks.try_emplace(ActorCheckKey(rule.actorId, rule.sceneNum, rule.actorParams));
+        if (inserted) {
+            slots->second.fill(RC_UNKNOWN_CHECK);
+        }
+        AddActorCheck(slots->second, rule.quest, rule.age, rule.rc);
+    }
+    std::stable_sort(sActorCheckRuleShapes.begin(), sActorCheckRuleShapes.end(),
+                     [](const ActorCheckRuleShape& a, const ActorCheckRuleShape& b) {
+                         int aBits = std::popcount((uint32_t)a.paramsMask);
+                         int bBits = std::popcount((uint32_t)b.paramsMask);
+                         return aBits != bBits ? aBits > bBits : a.anyActor < b.anyActor;
+                     });
+
+    // For locations sharing an actor, scene and params, the first one in the table for each quest wins
+    sCheckFromActorIndex.clear();
+    for (auto& location : locationTable) {
+        auto [slots, inserted] = sCheckFromActorIndex.try_emplace(
+            ActorCheckKey((int16_t)location.GetActorID(), (int16_t)location.GetScene(), location.GetActorParams()));
+        if (inserted) {
+            slots->second.fill(RC_UNKNOWN_CHECK);
+        }
+        AddActorCheck(slots->second, location.GetQuest(), ACTOR_CHECK_ANY_AGE, location.GetRandomizerCheck());
+    }
+}
+
+RandomizerCheck Rando::StaticData::GetCheckFromActor(s16 actorId, s16 sceneNum, s32 actorParams, bool isMQ,
+                                                     bool isAdult) {
+    size_t slot = ActorCheckSlot(isMQ, isAdult);
+
+    for (const ActorCheckRuleShape& shape : sActorCheckRuleShapes) {
+        auto it = shape.checks.find(
+            ActorCheckKey(shape.anyActor ? ACTOR_CHECK_ANY_ACTOR : actorId, sceneNum, actorParams & shape.paramsMask));
+        if (it != shape.checks.end() && it->second[slot] != RC_UNKNOWN_CHECK) {
+            return it->second[slot];
+        }
+    }
+
+    auto it = sCheckFromActorIndex.find(ActorCheckKey(actorId, sceneNum, actorParams));
+    return it != sCheckFromActorIndex.end() ? it->second[slot] : RC_UNKNOWN_CHECK;
 }
 
 Location* Rando::StaticData::GetLocation(RandomizerCheck locKey) {
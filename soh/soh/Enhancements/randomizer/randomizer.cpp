@@ -1032,130 +1032,8 @@ BeehiveIdentity Randomizer::IdentifyBeehive(s32 sceneNum, s16 xPosition, s32 res
 }
 
 Rando::Location* Randomizer::GetCheckObjectFromActor(s16 actorId, s16 sceneNum, s32 actorParams = 0x00) {
-    auto fs = OTRGlobals::Instance->gRandoContext->GetFishsanity();
-    RandomizerCheck specialRc = RC_UNKNOWN_CHECK;
-    // TODO: Migrate these special cases into table, or at least document why they are special
-    switch(sceneNum) {
-        case SCENE_TREASURE_BOX_SHOP: {
-            if ((actorId == ACTOR_EN_BOX && actorParams == 20170) || (actorId == ACTOR_ITEM_ETCETERA && actorParams == 2572)) {
-                specialRc = RC_MARKET_TREASURE_CHEST_GAME_REWARD;
-            }
-
-            // todo: handle the itemetc part of this so drawing works when we implement shuffle
-            if (actorId == ACTOR_EN_BOX) {
-                bool isAKey = (actorParams & 0x60) == 0x20;
-                if ((actorParams & 0xF) < 2) {
-                    specialRc = isAKey ? RC_MARKET_TREASURE_CHEST_GAME_KEY_1 : RC_MARKET_TREASURE_CHEST_GAME_ITEM_1;
-                } else if ((actorParams & 0xF) < 4) {
-                    specialRc = isAKey ? RC_MARKET_TREASURE_CHEST_GAME_KEY_2 : RC_MARKET_TREASURE_CHEST_GAME_ITEM_2;
-                } else if ((actorParams & 0xF) < 6) {
-                    specialRc = isAKey ? RC_MARKET_TREASURE_CHEST_GAME_KEY_3 : RC_MARKET_TREASURE_CHEST_GAME_ITEM_3;
-                } else if ((actorParams & 0xF) < 8) {
-                    specialRc = isAKey ? RC_MARKET_TREASURE_CHEST_GAME_KEY_4 : RC_MARKET_TREASURE_CHEST_GAME_ITEM_4;
-                } else if ((actorParams & 0xF) < 10) {
-                    specialRc = isAKey ? RC_MARKET_TREASURE_CHEST_GAME_KEY_5 : RC_MARKET_TREASURE_CHEST_GAME_ITEM_5;
-                }
-            }
-            break;
-        }
-        case SCENE_SACRED_FOREST_MEADOW:
-            if (actorId == ACTOR_EN_SA) {
-                specialRc = RC_SONG_FROM_SARIA;
-            }
-            break;
-        case SCENE_TEMPLE_OF_TIME_EXTERIOR_DAY:
-        case SCENE_TEMPLE_OF_TIME_EXTERIOR_NIGHT:
-        case SCENE_TEMPLE_OF_TIME_EXTERIOR_RUINS:
-            switch (actorParams) {
-                case 14342:
-                    specialRc = RC_TOT_LEFTMOST_GOSSIP_STONE;
-                    break;
-                case 14599:
-                    specialRc = RC_TOT_LEFT_CENTER_GOSSIP_STONE;
-                    break;
-                case 14862:
-                    specialRc = RC_TOT_RIGHT_CENTER_GOSSIP_STONE;
-                    break;
-                case 15120:
-                    specialRc = RC_TOT_RIGHTMOST_GOSSIP_STONE;
-                    break;
-            }
-            break;
-        case SCENE_HOUSE_OF_SKULLTULA:
-            if (actorId == ACTOR_EN_SSH) {
-                switch (actorParams) { // actor params are used to differentiate between textboxes
-                    case 1: specialRc = RC_KAK_10_GOLD_SKULLTULA_REWARD; break;
-                    case 2: specialRc = RC_KAK_20_GOLD_SKULLTULA_REWARD; break;
-                    case 3: specialRc = RC_KAK_30_GOLD_SKULLTULA_REWARD; break;
-                    case 4: specialRc = RC_KAK_40_GOLD_SKULLTULA_REWARD; break;
-                    case 5: specialRc = RC_KAK_50_GOLD_SKULLTULA_REWARD; break;
-                }
-            }
-            break;
-        case SCENE_KAKARIKO_VILLAGE:
-            switch (actorId) {
-                case ACTOR_EN_NIW_LADY:
-                    if (LINK_IS_ADULT) {
-                        specialRc = RC_KAK_ANJU_AS_ADULT;
-                    } else {
-                        specialRc = RC_KAK_ANJU_AS_CHILD;
-                    }
-            }
-            break;
-        case SCENE_LAKE_HYLIA:
-            switch (actorId) {
-                case ACTOR_ITEM_ETCETERA:
-                    if (LINK_IS_ADULT) {
-                        specialRc = RC_LH_SUN;
-                    } else {
-                        specialRc = RC_LH_UNDERWATER_ITEM;
-                    }
-            }
-            break;
-        case SCENE_ZORAS_FOUNTAIN:
-            switch (actorParams) {
-                case 15362:
-                case 14594:
-                    specialRc = RC_ZF_JABU_GOSSIP_STONE;
-                    break;
-                case 14849:
-                case 14337:
-                    specialRc = RC_ZF_FAIRY_GOSSIP_STONE;
-                    break;
-            }
-            break;
-        case SCENE_GERUDOS_FORTRESS:
-            // GF chest as child has different params and gives odd mushroom
-            // set it to the GF chest check for both ages
-            if (actorId == ACTOR_EN_BOX) {
-                specialRc = RC_GF_CHEST;
-            }
-            break;
-        case SCENE_DODONGOS_CAVERN:
-            // special case for MQ DC Gossip Stone
-            if (actorId == ACTOR_EN_GS && actorParams == 15892 && ResourceMgr_IsGameMasterQuest()) {
-                specialRc = RC_DODONGOS_CAVERN_GOSSIP_STONE;
-            }
-            break;
-    }
-
-    if (specialRc != RC_UNKNOWN_CHECK) {
-        return Rando::StaticData::GetLocation(specialRc);
-    }
-
-    auto range = Rando::StaticData::CheckFromActorMultimap.equal_range(std::make_tuple(actorId, sceneNum, actorParams));
-
-    for (auto it = range.first; it != range.second; ++it) {
-        if (
-            Rando::StaticData::GetLocation(it->second)->GetQuest() == RCQUEST_BOTH ||
-            (Rando::StaticData::GetLocation(it->second)->GetQuest() == RCQUEST_VANILLA && !ResourceMgr_IsGameMasterQuest()) ||
-            (Rando::StaticData::GetLocation(it->second)->GetQuest() == RCQUEST_MQ && ResourceMgr_IsGameMasterQuest())
-        ) {
-            return Rando::StaticData::GetLocation(it->second);
-        }
-    }
-
-    return Rando::StaticData::GetLocation(RC_UNKNOWN_CHECK);
+    return Rando::StaticData::GetLocation(Rando::StaticData::GetCheckFromActor(
+        actorId, sceneNum, actorParams, ResourceMgr_IsGameMasterQuest(), LINK_IS_ADULT));
 }
 
 ScrubIdentity Randomizer::IdentifyScrub(s32 sceneNum, s32 actorParams, s32 respawnData) {
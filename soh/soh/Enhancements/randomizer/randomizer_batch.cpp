@@ -0,0 +1,244 @@
+#include "randomizer_batch.h"
+#include "3drando/rando_main.hpp"
+#include "context.h"
+#include "entrance.h"
+#include "soh/OTRGlobals.h"
+#include "soh/cvar_prefixes.h"
+#include "soh/Enhancements/debugger/performanceTimer.h"
+
+#include <libultraship/libultraship.h>
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct BatchOptions {
+    std::string presetPath;
+    uint32_t firstSeed = 0;
+    uint32_t lastSeed = 0;
+    uint32_t threadCount = 0;
+    std::string timingsPath;
+};
+
+struct SeedResult {
+    bool success = false;
+    std::array<double, PT_MAX> phaseTimes = {};
+    int entrancePlacements = 0;
+};
+
+double EntrancePlacementsPerSecond(const SeedResult& result) {
+    double shuffleTimeMs = result.phaseTimes[PT_ENTRANCE_SHUFFLE];
+    return shuffleTimeMs > 0 ? result.entrancePlacements * 1000.0 / shuffleTimeMs : 0.0;
+}
+
+bool ParseOptions(int argc, char** argv, BatchOptions& options) {
+    try {
+        for (int i = 1; i < argc; i++) {
+            std::string arg = argv[i];
+            bool hasValue = i + 1 < argc;
+            if (arg == "--rando-batch" && hasValue) {
+                options.presetPath = argv[++i];
+            } else if (arg == "--seeds" && hasValue) {
+                std::string range = argv[++i];
+                size_t dash = range.find('-');
+                options.firstSeed = std::stoul(range.substr(0, dash));
+                options.lastSeed = dash == std::string::npos ? options.firstSeed : std::stoul(range.substr(dash + 1));
+            } else if (arg == "--threads" && hasValue) {
+                options.threadCount = std::stoul(argv[++i]);
+            } else if (arg == "--timings" && hasValue) {
+                options.timingsPath = argv[++i];
+            } else {
+                SPDLOG_ERROR("Unknown or incomplete batch argument: {}", arg);
+                return false;
+            }
+        }
+    } catch (std::exception& e) {
+        SPDLOG_ERROR("Invalid batch argument: {}", e.what());
+        return false;
+    }
+
+    if (options.lastSeed < options.firstSeed) {
+        SPDLOG_ERROR("Seed range {}-{} is empty", options.firstSeed, options.lastSeed);
+        return false;
+    }
+    return true;
+}
+
+void ApplyPresetCVars(const nlohmann::json& node, const std::string& prefix) {
+    for (auto& [key, value] : node.items()) {
+        std::string cvarName = prefix.empty() ? key : prefix + "." + key;
+        if (value.is_object()) {
+            ApplyPresetCVars(value, cvarName);
+        } else if (value.is_boolean() || value.is_number_integer()) {
+            CVarSetInteger(cvarName.c_str(), value.get<int32_t>());
+        } else if (value.is_number_float()) {
+            CVarSetFloat(cvarName.c_str(), value.get<float>());
+        } else if (value.is_string()) {
+            CVarSetString(cvarName.c_str(), value.get<std::string>().c_str());
+        }
+    }
+}
+
+bool LoadPreset(const std::string& presetPath) {
+    std::ifstream presetFile(presetPath);
+    if (!presetFile.is_open()) {
+        SPDLOG_ERROR("Could not open preset {}", presetPath);
+        return false;
+    }
+
+    try {
+        nlohmann::json preset = nlohmann::json::parse(presetFile);
+        ApplyPresetCVars(preset.contains("CVars") ? preset["CVars"] : preset, "");
+    } catch (nlohmann::json::exception& e) {
+        SPDLOG_ERROR("Could not parse preset {}: {}", presetPath, e.what());
+        return false;
+    }
+    return true;
+}
+
+template <typename T> std::set<T> ParseCVarList(const char* cvarName) {
+    std::set<T> values;
+    std::stringstream listStream(CVarGetString(cvarName, ""));
+    std::string value;
+    while (getline(listStream, value, ',')) {
+        try {
+            values.insert((T)std::stoi(value));
+        } catch (std::invalid_argument& e) {
+            SPDLOG_WARN("Skipping invalid entry \"{}\" in {}", value, cvarName);
+        } catch (std::out_of_range& e) {
+            SPDLOG_WARN("Skipping out of range entry \"{}\" in {}", value, cvarName);
+        }
+    }
+    return values;
+}
+
+void WriteTimingsCsv(std::ofstream& file, const std::vector<std::string>& seeds, const std::vector<SeedResult>& results) {
+    file << "seed,success";
+    for (size_t timer = 0; timer < PT_MAX; timer++) {
+        file << "," << GetPerformanceTimerName((TimerID)timer);
+    }
+    file << ",EntrancePlacements,EntrancePlacementsPerSecond\n";
+
+    for (size_t i = 0; i < seeds.size(); i++) {
+        file << seeds[i] << "," << (results[i].success ? 1 : 0);
+        for (double phaseTime : results[i].phaseTimes) {
+            file << "," << phaseTime;
+        }
+        file << "," << results[i].entrancePlacements << "," << EntrancePlacementsPerSecond(results[i]) << "\n";
+    }
+}
+
+void WriteTimingsJson(std::ofstream& file, const std::vector<std::string>& seeds, const std::vector<SeedResult>& results,
+                      uint32_t threadCount, double wallTimeMs, uint32_t generatedCount) {
+    nlohmann::ordered_json timings;
+    timings["threads"] = threadCount;
+    timings["wallTimeMs"] = wallTimeMs;
+    timings["seedsGenerated"] = generatedCount;
+    timings["seedsPerSecond"] = wallTimeMs > 0 ? generatedCount * 1000.0 / wallTimeMs : 0.0;
+
+    timings["seeds"] = nlohmann::ordered_json::array();
+    for (size_t i = 0; i < seeds.size(); i++) {
+        nlohmann::ordered_json seed;
+        seed["seed"] = seeds[i];
+        seed["success"] = results[i].success;
+        for (size_t timer = 0; timer < PT_MAX; timer++) {
+            seed["timings"][GetPerformanceTimerName((TimerID)timer)] = results[i].phaseTimes[timer];
+        }
+        seed["entrancePlacements"] = results[i].entrancePlacements;
+        seed["entrancePlacementsPerSecond"] = EntrancePlacementsPerSecond(results[i]);
+        timings["seeds"].push_back(seed);
+    }
+
+    file << timings.dump(4) << std::endl;
+}
+
+} // namespace
+
+extern "C" bool RandomizerBatch_IsRequested(int argc, char** argv) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--rando-batch") == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+extern "C" int RandomizerBatch_Run(int argc, char** argv) {
+    auto context = Ship::Context::CreateUninitializedInstance("Ship of Harkinian", appShortName, "shipofharkinian.json");
+    context->InitLogging();
+    context->InitConfiguration();
+    context->InitConsoleVariables();
+
+    BatchOptions options;
+    if (!ParseOptions(argc, argv, options) || !LoadPreset(options.presetPath)) {
+        return 1;
+    }
+
+    // Archives aren't loaded, so allow every dungeon variant the preset asks for
+    OTRGlobals::Instance = new OTRGlobals(true, true);
+
+    std::vector<std::string> seeds;
+    for (uint64_t seed = options.firstSeed; seed <= options.lastSeed; seed++) {
+        seeds.push_back(std::to_string(seed));
+    }
+    std::vector<SeedResult> results(seeds.size());
+
+    auto excludedLocations = ParseCVarList<RandomizerCheck>(CVAR_RANDOMIZER_SETTING("ExcludedLocations"));
+    auto enabledTricks = ParseCVarList<RandomizerTrick>(CVAR_RANDOMIZER_SETTING("EnabledTricks"));
+
+    uint32_t threadCount = options.threadCount != 0 ? options.threadCount : std::max(1u, std::thread::hardware_concurrency());
+    SPDLOG_INFO("Generating {} seeds on {} threads", seeds.size(), threadCount);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    uint32_t generatedCount = RandoMain::GenerateRandoBatch(
+        seeds, excludedLocations, enabledTricks, threadCount, [&results](size_t seedIndex, bool success) {
+            // Performance timers are per thread, so they still hold this seed's times here
+            results[seedIndex].success = success;
+            for (size_t timer = 0; timer < PT_MAX; timer++) {
+                results[seedIndex].phaseTimes[timer] = GetPerformanceTimer((TimerID)timer).count();
+            }
+            results[seedIndex].entrancePlacements =
+                Rando::Context::GetInstance()->GetEntranceShuffler()->GetPlacementAttempts();
+        });
+    double wallTimeMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+    SPDLOG_INFO("Generated {}/{} seeds in {}ms ({} seeds/sec)", generatedCount, seeds.size(), wallTimeMs,
+                wallTimeMs > 0 ? generatedCount * 1000.0 / wallTimeMs : 0.0);
+
+    SeedResult entranceTotals;
+    for (const SeedResult& result : results) {
+        entranceTotals.entrancePlacements += result.entrancePlacements;
+        entranceTotals.phaseTimes[PT_ENTRANCE_SHUFFLE] += result.phaseTimes[PT_ENTRANCE_SHUFFLE];
+    }
+    if (entranceTotals.entrancePlacements > 0) {
+        SPDLOG_INFO("Tried {} entrance placements ({} placements/sec per thread)", entranceTotals.entrancePlacements,
+                    EntrancePlacementsPerSecond(entranceTotals));
+    }
+
+    if (!options.timingsPath.empty()) {
+        std::ofstream timingsFile(options.timingsPath);
+        if (!timingsFile.is_open()) {
+            SPDLOG_ERROR("Could not write timings to {}", options.timingsPath);
+            return 1;
+        }
+        if (std::filesystem::path(options.timingsPath).extension() == ".json") {
+            WriteTimingsJson(timingsFile, seeds, results, threadCount, wallTimeMs, generatedCount);
+        } else {
+            WriteTimingsCsv(timingsFile, seeds, results);
+        }
+    }
+
+    return generatedCount == seeds.size() ? 0 : 2;
+}
@@ -0,0 +1,22 @@
+#ifndef RANDOMIZER_BATCH_H
+#define RANDOMIZER_BATCH_H
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Headless seed generation, started with:
+//   --rando-batch <preset.json> [--seeds <first>[-<last>]] [--threads <count>] [--timings <file.csv|file.json>]
+// The preset is a JSON object of CVar names to values, either flat ("gRandoSettings.Forest": 1) or nested
+// the way shipofharkinian.json stores them. Spoiler logs are written to the usual Randomizer folder.
+// Timings include the entrance placements each seed tried and how many it got through per second of entrance shuffle.
+bool RandomizerBatch_IsRequested(int argc, char** argv);
+int RandomizerBatch_Run(int argc, char** argv);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -1369,6 +1369,28 @@ bool IsHeartPiece(GetItemID giid) {
     return giid == GI_HEART_PIECE || giid == GI_HEART_PIECE_WIN;
 }
 
+// The world graph is thread local and is usually built on the generation thread, so the tracker builds its own
+// from the loaded seed's context. Which regions exist depends on the dungeon quests, so it's rebuilt whenever the
+// seed or its MQ dungeons differ from the ones it was built for.
+static void EnsureTrackerRegionTable() {
+    static uint32_t builtSeed = 0;
+    static uint32_t builtMQDungeons = 0;
+    auto ctx = Rando::Context::GetInstance();
+    uint32_t seed = ctx->GetSettings()->GetSeed();
+    uint32_t mqDungeons = 0;
+    for (size_t i = 0; i < ctx->GetDungeons()->GetDungeonListSize(); i++) {
+        if (ctx->GetDungeon(i)->IsMQ()) {
+            mqDungeons |= 1 << i;
+        }
+    }
+
+    if (areaTable[RR_ROOT].regionName.empty() || seed != builtSeed || mqDungeons != builtMQDungeons) {
+        RegionTable_Init();
+        builtSeed = seed;
+        builtMQDungeons = mqDungeons;
+    }
+}
+
 void DrawLocation(RandomizerCheck rc) {
     Color_RGBA8 mainColor;
     Color_RGBA8 extraColor;
@@ -1529,6 +1551,7 @@ void DrawLocation(RandomizerCheck rc) {
     }
     
     if (showLogicTooltip) {
+        EnsureTrackerRegionTable();
         for (auto& locationInRegion : areaTable[itemLoc->GetParentRegionKey()].locations) {
             if (locationInRegion.GetLocation() == rc) {
                 std::string conditionStr = locationInRegion.GetConditionStr();
@@ -1530,6 +1530,14 @@ void Settings::SetAllFromCVar() {
     }
 }
 
+void Settings::SetAllFromSettings(const Settings& other) {
+    for (size_t i = 0; i < RSK_MAX; i++) {
+        if (!mOptions[i].GetCVarName().empty()) {
+            mOptions[i].SetSelectedIndex(other.mOptions[i].GetSelectedOptionIndex());
+        }
+    }
+}
+
 void Settings::UpdateOptionProperties() {
     // Default to hiding bridge opts and the extra sliders.
     mOptions[RSK_RAINBOW_BRIDGE].AddFlag(IMFLAG_SEPARATOR_BOTTOM);
@@ -148,6 +148,12 @@ class Settings {
     */
     void SetAllFromCVar();
 
+    /**
+     * @brief sets the `selectedOption` of all Options that have a `cvarName` to the
+     * one selected in `other`. Lets several contexts share settings read from CVars once.
+    */
+    void SetAllFromSettings(const Settings& other);
+
     /**
      * @brief Updates various properties of options based on the value of other options.
      * Used to update visibility, whether or not interaction is disabled, and what the
@@ -34,7 +34,9 @@ class StaticData {
       static std::array<Rando::Location, RC_MAX>& GetLocationTable();
       static std::unordered_map<std::string, uint32_t> PopulateTranslationMap(std::unordered_map<uint32_t, CustomMessage> input);
       static std::unordered_map<std::string, uint32_t> PopulateTranslationMap(std::unordered_map<uint32_t, RandomizerHintTextKey> input);
-      static std::multimap<std::tuple<s16, s16, s32>, RandomizerCheck> CheckFromActorMultimap;
+      static void InitCheckFromActorIndex();
+      // Check given by an actor, or RC_UNKNOWN_CHECK. Special cases are looked up before the location table entries
+      static RandomizerCheck GetCheckFromActor(s16 actorId, s16 sceneNum, s32 actorParams, bool isMQ, bool isAdult);
       static std::vector<RandomizerCheck> GetOverworldLocations();
       static std::vector<RandomizerCheck> GetAllDungeonLocations();
       static std::vector<RandomizerCheck> dungeonRewardLocations;
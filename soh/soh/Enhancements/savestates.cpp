@@ -2,12 +2,16 @@
 
 #include <GameVersions.h>
 
+#include <array>
 #include <cstdio> // std::sprintf
+#include <cstring>
+#include <vector>
 
 #include <spdlog/spdlog.h>
 
 #include <soh/OTRGlobals.h>
 #include <soh/OTRAudio.h>
+#include "soh/cvar_prefixes.h"
 
 #include "z64.h"
 #include "z64save.h"
@@ -37,9 +41,6 @@ typedef struct {
 #include "savestates_extern.inc"
 
 typedef struct SaveStateInfo {
-    unsigned char sysHeapCopy[SYSTEM_HEAP_SIZE];
-    unsigned char audioHeapCopy[AUDIO_HEAP_SIZE];
-
     SaveContext saveContextCopy;
     GameInfo gameInfoCopy;
     LightsBuffer lightBufferCopy;
@@ -330,6 +331,99 @@ typedef struct SaveStateInfo {
 
 } SaveStateInfo;
 
+// Only one state is saved or loaded at a time, so they all stage their SaveStateInfo here
+static SaveStateInfo sSaveStateInfo;
+
+#define SAVE_STATE_PAGE_SIZE 0x1000
+
+typedef std::array<uint8_t, SAVE_STATE_PAGE_SIZE> SaveStatePage;
+
+// A copy of a block of memory kept as fixed size pages. Pages that haven't changed since the previous state's copy
+// of the same block are shared with it, and all-zero pages aren't stored at all, so a state only costs the pages
+// written to since the state before it.
+class PagedCopy {
+  public:
+    // Returns the number of bytes stored for pages that couldn't be shared
+    size_t Capture(const void* src, size_t size, const PagedCopy* previous);
+    void Restore(void* dst, size_t size) const;
+    size_t BytesSharedWith(const PagedCopy& other) const;
+
+  private:
+    std::vector<std::shared_ptr<const SaveStatePage>> pages; // nullptr for an all-zero page
+    size_t size = 0;
+
+    size_t PageSize(size_t index) const;
+};
+
+size_t PagedCopy::PageSize(size_t index) const {
+    return std::min<size_t>(SAVE_STATE_PAGE_SIZE, this->size - index * SAVE_STATE_PAGE_SIZE);
+}
+
+size_t PagedCopy::Capture(const void* src, size_t size, const PagedCopy* previous) {
+    static const SaveStatePage zeroPage = {};
+    const uint8_t* bytes = (const uint8_t*)src;
+    size_t pageCount = (size + SAVE_STATE_PAGE_SIZE - 1) / SAVE_STATE_PAGE_SIZE;
+    size_t storedBytes = 0;
+    if (previous != nullptr && previous->size != size) {
+        previous = nullptr;
+    }
+    this->size = size;
+
+    std::vector<std::shared_ptr<const SaveStatePage>> newPages(pageCount);
+    for (size_t i = 0; i < pageCount; i++) {
+        const uint8_t* page = bytes + i * SAVE_STATE_PAGE_SIZE;
+        size_t pageSize = PageSize(i);
+
+        if (previous != nullptr) {
+            const auto& previousPage = previous->pages[i];
+            if (memcmp(page, previousPage != nullptr ? previousPage->data() : zeroPage.data(), pageSize) == 0) {
+                newPages[i] = previousPage;
+                continue;
+            }
+        }
+        if (memcmp(page, zeroPage.data(), pageSize) == 0) {
+            continue;
+        }
+
+        auto copy = std::make_shared<SaveStatePage>();
+        memcpy(copy->data(), page, pageSize);
+        newPages[i] = std::move(copy);
+        storedBytes += pageSize;
+    }
+
+    this->pages = std::move(newPages);
+    return storedBytes;
+}
+
+void PagedCopy::Restore(void* dst, size_t size) const {
+    uint8_t* bytes = (uint8_t*)dst;
+    for (size_t i = 0; i < this->pages.size(); i++) {
+        size_t pageSize = PageSize(i);
+        if (this->pages[i] != nullptr) {
+            memcpy(bytes + i * SAVE_STATE_PAGE_SIZE, this->pages[i]->data(), pageSize);
+        } else {
+            memset(bytes + i * SAVE_STATE_PAGE_SIZE, 0, pageSize);
+        }
+    }
+}
+
+size_t PagedCopy::BytesSharedWith(const PagedCopy& other) const {
+    size_t sharedBytes = 0;
+    for (size_t i = 0; i < std::min(this->pages.size(), other.pages.size()); i++) {
+        if (this->pages[i] != nullptr && this->pages[i] == other.pages[i]) {
+            sharedBytes += PageSize(i);
+        }
+    }
+    return sharedBytes;
+}
+
+typedef enum {
+    SAVE_STATE_BLOCK_SYSTEM_HEAP,
+    SAVE_STATE_BLOCK_AUDIO_HEAP,
+    SAVE_STATE_BLOCK_INFO,
+    SAVE_STATE_BLOCK_MAX,
+} SaveStateBlock;
+
 class SaveState {
     friend class SaveStateMgr;
 
@@ -339,7 +433,10 @@ class SaveState {
   private:
     unsigned int slot;
     std::shared_ptr<SaveStateMgr> saveStateMgr;
-    std::shared_ptr<SaveStateInfo> info;
+    SaveStateInfo* info;
+    std::array<PagedCopy, SAVE_STATE_BLOCK_MAX> blocks;
+    // Bytes of pages held by this state and no state saved before it
+    size_t storedBytes;
 
     void Save(void);
     void Load(void);
@@ -356,17 +453,27 @@ class SaveState {
     void LoadMiscCodeData(void);
 
     SaveStateInfo* GetSaveStateInfo(void);
+    size_t BytesSharedWith(const SaveState& other) const;
 };
 
-SaveStateMgr::SaveStateMgr() {
+SaveStateMgr::SaveStateMgr() : rewindBytes(0), rewindFrames(0) {
     this->SetCurrentSlot(0);
 }
 SaveStateMgr::~SaveStateMgr() { 
     this->states.clear();
+    this->rewindStates.clear();
+}
+
+SaveState::SaveState(std::shared_ptr<SaveStateMgr> mgr, unsigned int slot)
+    : saveStateMgr(mgr), slot(slot), info(&sSaveStateInfo), storedBytes(0) {
 }
 
-SaveState::SaveState(std::shared_ptr<SaveStateMgr> mgr, unsigned int slot) : saveStateMgr(mgr), slot(slot), info(nullptr) {
-    this->info = std::make_shared<SaveStateInfo>();
+size_t SaveState::BytesSharedWith(const SaveState& other) const {
+    size_t sharedBytes = 0;
+    for (size_t i = 0; i < SAVE_STATE_BLOCK_MAX; i++) {
+        sharedBytes += this->blocks[i].BytesSharedWith(other.blocks[i]);
+    }
+    return sharedBytes;
 }
 
 void SaveState::BackupSeqScriptState(void) {
@@ -832,6 +939,8 @@ unsigned int SaveStateMgr::GetCurrentSlot(void) {
 }
 
 void SaveStateMgr::ProcessSaveStateRequests(void) {
+    bool loaded = false;
+
     while (!this->requests.empty()) {
         const auto& request = this->requests.front();
         
@@ -841,22 +950,82 @@ void SaveStateMgr::ProcessSaveStateRequests(void) {
                     this->states[request.slot] = std::make_shared<SaveState>(OTRGlobals::Instance->gSaveStateMgr, request.slot);
                 }
                 this->states[request.slot]->Save();
+                this->lastSaved = this->states[request.slot];
                 Ship::Context::GetInstance()->GetWindow()->GetGui()->GetGameOverlay()->TextDrawNotification(1.0f, true, "saved state %u", request.slot);
                 break;
             case RequestType::LOAD:
                 if (this->states.contains(request.slot)) {
                     this->states[request.slot]->Load();
+                    loaded = true;
+                    // The rewind buffer holds the timeline that was just left
+                    this->rewindStates.clear();
+                    this->rewindBytes = 0;
                     Ship::Context::GetInstance()->GetWindow()->GetGui()->GetGameOverlay()->TextDrawNotification(1.0f, true, "loaded state %u", request.slot);
                 } else {
                     SPDLOG_ERROR("Invalid SaveState slot: {}", request.slot);
                 }
                 break;
+            case RequestType::REWIND:
+                if (!this->rewindStates.empty()) {
+                    std::shared_ptr<SaveState> state = this->rewindStates.back();
+                    this->rewindStates.pop_back();
+                    this->rewindBytes -= state->storedBytes;
+                    // The next capture shares pages with the newest state still in the buffer, not the one dropped
+                    this->lastSaved = this->rewindStates.empty() ? nullptr : this->rewindStates.back();
+                    state->Load();
+                    loaded = true;
+                }
+                break;
             [[unlikely]] default: 
                 SPDLOG_ERROR("Invalid SaveState request type: Unknown ({})", static_cast<int>(request.type));
                 break;
         }
         this->requests.pop();
     }
+
+    // Capturing straight after a load would only record the state that was just loaded, and stop a held rewind
+    // from going back any further
+    if (gPlayState != nullptr && CVarGetInteger(CVAR_CHEAT("SaveStatesEnabled"), 0) &&
+        CVarGetInteger(CVAR_CHEAT("SaveStateRewind"), 0)) {
+        if (!loaded) {
+            this->CaptureRewindState();
+        }
+    } else if (!this->rewindStates.empty()) {
+        this->rewindStates.clear();
+        this->rewindBytes = 0;
+    }
+}
+
+void SaveStateMgr::CaptureRewindState(void) {
+    if (++this->rewindFrames < (unsigned int)CVarGetInteger(CVAR_CHEAT("SaveStateRewindInterval"), 1)) {
+        return;
+    }
+    this->rewindFrames = 0;
+
+    auto state = std::make_shared<SaveState>(OTRGlobals::Instance->gSaveStateMgr, REWIND_SLOT);
+    std::shared_ptr<SaveState> previous = this->lastSaved;
+    state->Save();
+    // Pages shared with a state outside the buffer, such as a slot or one that was just loaded, aren't counted by
+    // anything already in it
+    if (previous != nullptr && (this->rewindStates.empty() || this->rewindStates.back() != previous)) {
+        state->storedBytes += state->BytesSharedWith(*previous);
+    }
+    this->lastSaved = state;
+    this->rewindBytes += state->storedBytes;
+    this->rewindStates.push_back(state);
+
+    size_t budget = (size_t)CVarGetInteger(CVAR_CHEAT("SaveStateRewindMemory"), 256) * 1024 * 1024;
+    while (this->rewindStates.size() > 1 && this->rewindBytes > budget) {
+        std::shared_ptr<SaveState> oldest = this->rewindStates.front();
+        this->rewindStates.pop_front();
+        this->rewindBytes -= oldest->storedBytes;
+
+        // Pages the next state shared with the dropped one are now only held by it
+        SaveState& next = *this->rewindStates.front();
+        size_t inheritedBytes = next.BytesSharedWith(*oldest);
+        next.storedBytes += inheritedBytes;
+        this->rewindBytes += inheritedBytes;
+    }
 }
 
 SaveStateReturn SaveStateMgr::AddRequest(const SaveStateRequest request) {
@@ -879,6 +1048,14 @@ SaveStateReturn SaveStateMgr::AddRequest(const SaveStateRequest request) {
                 Ship::Context::GetInstance()->GetWindow()->GetGui()->GetGameOverlay()->TextDrawNotification(1.0f, true, "state slot %u empty", request.slot);
                 return SaveStateReturn::FAIL_INVALID_SLOT;
             }
+        case RequestType::REWIND:
+            if (!rewindStates.empty()) {
+                requests.push(request);
+                return SaveStateReturn::SUCCESS;
+            } else {
+                Ship::Context::GetInstance()->GetWindow()->GetGui()->GetGameOverlay()->TextDrawNotification(1.0f, true, "nothing to rewind");
+                return SaveStateReturn::FAIL_STATE_EMPTY;
+            }
         [[unlikely]] default: 
             SPDLOG_ERROR("Invalid SaveState request type: Unknown ({})", static_cast<int>(request.type));
             return SaveStateReturn::FAIL_BAD_REQUEST;
@@ -886,10 +1063,7 @@ SaveStateReturn SaveStateMgr::AddRequest(const SaveStateRequest request) {
 }
 
 void SaveState::Save(void) {
-    std::unique_lock<std::mutex> Lock(audio.mutex);
-    memcpy(&info->sysHeapCopy, gSystemHeap, SYSTEM_HEAP_SIZE /* sizeof(gSystemHeap) */);
-    memcpy(&info->audioHeapCopy, gAudioHeap, AUDIO_HEAP_SIZE /* sizeof(gAudioContext) */);
-
+    OTRAudio_WaitForIdle();
     memcpy(&info->audioContextCopy, &gAudioContext, sizeof(AudioContext));
     memcpy(&info->gActiveSeqsCopy, gActiveSeqs, sizeof(info->gActiveSeqsCopy));
     BackupSeqScriptState();
@@ -922,12 +1096,21 @@ void SaveState::Save(void) {
     SaveOverlayStaticData();
     SaveMiscCodeData();
 
+    // Only pages written to since the last state was saved need copying
+    const SaveState* previous = saveStateMgr->lastSaved.get();
+    auto capture = [&](SaveStateBlock block, const void* src, size_t size) {
+        return blocks[block].Capture(src, size, previous != nullptr ? &previous->blocks[block] : nullptr);
+    };
+    storedBytes = capture(SAVE_STATE_BLOCK_SYSTEM_HEAP, gSystemHeap, SYSTEM_HEAP_SIZE) +
+                  capture(SAVE_STATE_BLOCK_AUDIO_HEAP, gAudioHeap, AUDIO_HEAP_SIZE) +
+                  capture(SAVE_STATE_BLOCK_INFO, info, sizeof(SaveStateInfo));
 }
 
 void SaveState::Load(void) {
-    std::unique_lock<std::mutex> Lock(audio.mutex);
-    memcpy(gSystemHeap, &info->sysHeapCopy, SYSTEM_HEAP_SIZE);
-    memcpy(gAudioHeap, &info->audioHeapCopy, AUDIO_HEAP_SIZE);
+    OTRAudio_WaitForIdle();
+    blocks[SAVE_STATE_BLOCK_SYSTEM_HEAP].Restore(gSystemHeap, SYSTEM_HEAP_SIZE);
+    blocks[SAVE_STATE_BLOCK_AUDIO_HEAP].Restore(gAudioHeap, AUDIO_HEAP_SIZE);
+    blocks[SAVE_STATE_BLOCK_INFO].Restore(info, sizeof(SaveStateInfo));
 
     memcpy(&gAudioContext, &info->audioContextCopy, sizeof(AudioContext));
     memcpy(gActiveSeqs, &info->gActiveSeqsCopy, sizeof(info->gActiveSeqsCopy));
@@ -2,6 +2,7 @@
 #define SAVE_STATES_H
 
 #include <cstdint>
+#include <deque>
 #include <queue>
 #include <unordered_map>
 #include <memory>
@@ -25,8 +26,12 @@ typedef struct SaveStateHeader {
 enum class RequestType {
     SAVE,
     LOAD,
+    REWIND, // Loads the newest rewind state, then drops it
 };
 
+// Slot number of states in the rewind buffer, which aren't in a slot
+#define REWIND_SLOT UINT32_MAX
+
 typedef struct SaveStateRequest {
     unsigned int slot;
     RequestType type;
@@ -41,6 +46,15 @@ class SaveStateMgr {
     std::unordered_map<unsigned int, std::shared_ptr<SaveState>> states;
     std::queue <SaveStateRequest> requests;
     std::mutex mutex;
+
+    // States share unchanged pages with the state saved before them, so each new one is compared against this
+    std::shared_ptr<SaveState> lastSaved;
+    // Captured every few frames while rewind is enabled, oldest first, and trimmed to a memory budget
+    std::deque<std::shared_ptr<SaveState>> rewindStates;
+    size_t rewindBytes;
+    unsigned int rewindFrames;
+
+    void CaptureRewindState(void);
     
   public:
 
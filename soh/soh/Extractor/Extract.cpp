@@ -8,6 +8,7 @@
 #include "portable-file-dialogs.h"
 #include <utils/binarytools/BitConverter.h>
 #include "variables.h"
+#include <spdlog/spdlog.h>
 
 #ifdef unix
 #include <dirent.h>
@@ -41,13 +42,16 @@
 #include <stdlib.h>
 
 #include <SDL2/SDL_messagebox.h>
+#include <SDL2/SDL_thread.h>
 
 #include <array>
+#include <atomic>
 #include <fstream>
 #include <filesystem>
 #include <unordered_map>
 #include <random>
 #include <string>
+#include <thread>
 
 extern "C" uint32_t CRC32C(unsigned char* data, size_t dataSize);
 
@@ -561,7 +565,61 @@ std::string Extractor::Mkdtemp() {
 
 extern "C" int zapd_main(int argc, char** argv);
 
-bool Extractor::CallZapd(std::string installPath, std::string exportdir) {
+static constexpr size_t ZAPD_THREAD_STACK_SIZE = 8 * MB_BASE;
+
+struct ZapdThreadArgs {
+    int argc;
+    char** argv;
+    std::atomic<bool> finished;
+};
+
+static int SDLCALL RunZapdThread(void* data) {
+    ZapdThreadArgs* args = static_cast<ZapdThreadArgs*>(data);
+    int result = zapd_main(args->argc, args->argv);
+    args->finished = true;
+    return result;
+}
+
+void Extractor::ShowProgress(const ExtractionProgress& progress) {
+    static int64_t lastReportedSeconds = -1;
+    int64_t seconds = std::chrono::duration_cast<std::chrono::seconds>(progress.elapsed).count();
+
+    switch (progress.stage) {
+        case ExtractionStage::Preparing:
+            lastReportedSeconds = -1;
+            break;
+        case ExtractionStage::Extracting:
+            if (seconds == lastReportedSeconds) {
+                break;
+            }
+            lastReportedSeconds = seconds;
+#ifdef _WIN32
+            {
+                char title[64];
+                snprintf(title, sizeof(title), "Extracting assets... %llds", (long long)seconds);
+                SetConsoleTitleA(title);
+            }
+#else
+            if (seconds % 5 == 0) {
+                SPDLOG_INFO("Extracting assets... {}s", seconds);
+            }
+#endif
+            break;
+        case ExtractionStage::Finalizing:
+            break;
+        case ExtractionStage::Done:
+            SPDLOG_INFO("Extraction finished in {:.1f}s", progress.elapsed.count() / 1000.0);
+#ifndef _WIN32
+            pfd::notify("Extraction Complete", "Assets were extracted in " + std::to_string(seconds) + " seconds.");
+#endif
+            break;
+        case ExtractionStage::Failed:
+            SPDLOG_ERROR("Extraction failed after {:.1f}s", progress.elapsed.count() / 1000.0);
+            break;
+    }
+}
+
+bool Extractor::CallZapd(std::string installPath, std::string exportdir, const ExtractionProgressCallback& onProgress) {
     constexpr int argc = 18;
     char xmlPath[1024];
     char confPath[1024];
@@ -569,10 +627,24 @@ bool Extractor::CallZapd(std::string installPath, std::string exportdir) {
     std::array<const char*, argc> argv;
     const char* version = GetZapdVerStr();
     const char* otrFile = IsMasterQuest() ? "oot-mq.otr" : "oot.otr";
+    auto start = std::chrono::steady_clock::now();
+    auto report = [&](ExtractionStage stage) {
+        if (onProgress) {
+            onProgress({ stage, std::chrono::duration_cast<std::chrono::milliseconds>(
+                                    std::chrono::steady_clock::now() - start) });
+        }
+    };
+
+    report(ExtractionStage::Preparing);
 
     std::string romPath = std::filesystem::absolute(mCurrentRomPath).string();
     installPath = std::filesystem::absolute(installPath).string();
     exportdir = std::filesystem::absolute(exportdir).string();
+    // ZAPD writes the archive straight into the export folder. It gets a temporary name until it's complete, so a
+    // crash part way through can't leave behind an archive that looks finished.
+    std::string otrPath = exportdir + "/" + otrFile;
+    std::string partialOtrPath = otrPath + ".part";
+    std::filesystem::remove(partialOtrPath);
     // Work this out in the temporary folder
     std::string tempdir = Mkdtemp();
     std::string curdir = std::filesystem::current_path().string();
@@ -604,7 +676,7 @@ bool Extractor::CallZapd(std::string installPath, std::string exportdir) {
     argv[12] = "-se";
     argv[13] = "OTR";
     argv[14] = "--otrfile";
-    argv[15] = otrFile;
+    argv[15] = partialOtrPath.c_str();
     argv[16] = "--portVer";
     argv[17] = portVersion;
 
@@ -616,22 +688,41 @@ bool Extractor::CallZapd(std::string installPath, std::string exportdir) {
     ShowWindow(cmdWindow, SW_SHOW);
     SetWindowPos(cmdWindow, HWND_NOTOPMOST, 0, 0, 0, 0, SWP_NOSIZE | SWP_NOMOVE);
 #else
-    // Show extraction in background message until linux/mac can have visual progress
-    SDL_ShowSimpleMessageBox(SDL_MESSAGEBOX_INFORMATION, "Extracting", "Extraction will now begin in the background.\n\nPlease be patient for the process to finish. Do not close the main program.", nullptr);
+    // Let the user know extraction has started without blocking it behind a message box
+    pfd::notify("Extracting", "Extraction has begun.\n\nPlease be patient for the process to finish. Do not close the main program.");
 #endif
 
-    zapd_main(argc, (char**)argv.data());
+    // ZAPD keeps its state in globals, so it still extracts on a single thread. Running it on its own thread leaves
+    // this one free to report progress. ZAPD was written to run on the main thread, so its thread gets a main thread
+    // sized stack rather than the platform default, which is only 512 KB on macOS.
+    ZapdThreadArgs zapdArgs{ argc, (char**)argv.data(), false };
+    SDL_Thread* zapdThread = SDL_CreateThreadWithStackSize(RunZapdThread, "ZAPD", ZAPD_THREAD_STACK_SIZE, &zapdArgs);
+    if (zapdThread == nullptr) {
+        SPDLOG_ERROR("Failed to start the ZAPD thread: {}", SDL_GetError());
+        zapd_main(argc, (char**)argv.data());
+    } else {
+        while (!zapdArgs.finished) {
+            report(ExtractionStage::Extracting);
+            std::this_thread::sleep_for(std::chrono::milliseconds(250));
+        }
+        SDL_WaitThread(zapdThread, nullptr);
+    }
 
 #ifdef _WIN32
     // Hide the command window again.
     ShowWindow(cmdWindow, SW_HIDE);
 #endif
 
-    std::filesystem::copy(otrFile, exportdir + "/" + otrFile, std::filesystem::copy_options::overwrite_existing);
+    report(ExtractionStage::Finalizing);
+    bool success = std::filesystem::exists(partialOtrPath);
+    if (success) {
+        std::filesystem::rename(partialOtrPath, otrPath);
+    }
 
     // Go back to where this game was executed from
     std::filesystem::current_path(curdir);
     std::filesystem::remove_all(tempdir);
 
-    return 0;
+    report(success ? ExtractionStage::Done : ExtractionStage::Failed);
+    return success;
 }
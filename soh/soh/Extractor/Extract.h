@@ -2,6 +2,8 @@
 #define EXTRACT_H
 
 #include <stdint.h>
+#include <chrono>
+#include <functional>
 #include <string>
 #include <memory>
 #include <vector>
@@ -25,6 +27,25 @@ enum class RomSearchMode {
   MQ = 2,
 };
 
+enum class ExtractionStage {
+  Preparing,
+  Extracting,
+  Finalizing,
+  Done,
+  Failed,
+};
+
+// ZAPD doesn't report how far through the XMLs it is, so this is the stage and a running timer rather than a
+// fraction done
+struct ExtractionProgress {
+  ExtractionStage stage;
+  // Time since CallZapd started
+  std::chrono::milliseconds elapsed;
+};
+
+// Called on the thread that called CallZapd, at every stage change and a few times a second while ZAPD is running
+using ExtractionProgressCallback = std::function<void(const ExtractionProgress&)>;
+
 class Extractor {
     std::unique_ptr<unsigned char[]> mRomData = std::make_unique<unsigned char[]>(MB64);
     std::string mCurrentRomPath;
@@ -59,8 +80,11 @@ class Extractor {
     static void ShowErrorBox(const char* title, const char* text);
     bool IsMasterQuest() const;
 
+    static void ShowProgress(const ExtractionProgress& progress);
+
     bool Run(std::string searchPath, RomSearchMode searchMode = RomSearchMode::Both);
-    bool CallZapd(std::string installPath, std::string exportdir);
+    bool CallZapd(std::string installPath, std::string exportdir,
+                  const ExtractionProgressCallback& onProgress = Extractor::ShowProgress);
     const char* GetZapdStr();
     std::string Mkdtemp();
 };
@@ -3,6 +3,16 @@
 #include "Network.h"
 #include <spdlog/spdlog.h>
 #include <libultraship/libultraship.h>
+#include "soh/Enhancements/game-interactor/GameInteractor.h"
+
+#include <algorithm>
+#include <chrono>
+
+// How long the receive thread blocks waiting on the socket before checking whether it should stop
+#define RECEIVE_WAIT_MS 100
+// Reconnect attempts back off from the first delay to the max, and start over once a connection is made
+#define RECONNECT_FIRST_DELAY_MS 250
+#define RECONNECT_MAX_DELAY_MS 5000
 
 // MARK: - Public
 
@@ -22,6 +32,8 @@ void Network::Enable(const char* host, uint16_t port) {
         receiveThread.join();
     }
 
+    onGameFrameUpdateHook = GameInteractor::Instance->RegisterGameHook<GameInteractor::OnGameFrameUpdate>(
+        [this]() { ProcessQueuedPackets(); });
     receiveThread = std::thread(&Network::ReceiveFromServer, this);
 }
 
@@ -30,8 +42,17 @@ void Network::Disable() {
         return;
     }
 
-    isEnabled = false;
+    {
+        std::lock_guard<std::mutex> lock(enabledMutex);
+        isEnabled = false;
+    }
+    enabledChanged.notify_all();
     receiveThread.join();
+
+    GameInteractor::Instance->UnregisterGameHook<GameInteractor::OnGameFrameUpdate>(onGameFrameUpdateHook);
+    onGameFrameUpdateHook = 0;
+    // Drop anything the game thread hadn't gotten to yet
+    packetQueueHead = packetQueueTail.load();
 }
 
 void Network::OnIncomingData(char payload[512]) {
@@ -58,6 +79,8 @@ void Network::SendJsonToRemote(nlohmann::json payload) {
 // MARK: - Private
 
 void Network::ReceiveFromServer() {
+    uint32_t reconnectDelayMs = 0;
+
     while (isEnabled) {
         while (!isConnected && isEnabled) {
             SPDLOG_TRACE("[Network] Attempting to make connection to server...");
@@ -65,11 +88,17 @@ void Network::ReceiveFromServer() {
 
             if (networkSocket) {
                 isConnected = true;
+                reconnectDelayMs = 0;
                 SPDLOG_INFO("[Network] Connection to server established!");
 
                 OnConnected();
                 break;
             }
+
+            reconnectDelayMs = std::clamp(reconnectDelayMs * 2, (uint32_t)RECONNECT_FIRST_DELAY_MS,
+                                          (uint32_t)RECONNECT_MAX_DELAY_MS);
+            std::unique_lock<std::mutex> lock(enabledMutex);
+            enabledChanged.wait_for(lock, std::chrono::milliseconds(reconnectDelayMs), [this] { return !isEnabled; });
         }
 
         SDLNet_SocketSet socketSet = SDLNet_AllocSocketSet(1);
@@ -77,10 +106,14 @@ void Network::ReceiveFromServer() {
             SDLNet_TCP_AddSocket(socketSet, networkSocket);
         }
 
+        receivedData.clear();
+        // Everything before this has been searched for a delimiter already
+        size_t scannedLength = 0;
+
         // Listen to socket messages
         while (isConnected && networkSocket && isEnabled) {
-            // we check first if socket has data, to not block in the TCP_Recv
-            int socketsReady = SDLNet_CheckSockets(socketSet, 0);
+            // Sleep until the socket has data, so TCP_Recv doesn't block past a Disable
+            int socketsReady = SDLNet_CheckSockets(socketSet, RECEIVE_WAIT_MS);
 
             if (socketsReady == -1) {
                 SPDLOG_ERROR("[Network] SDLNet_CheckSockets: {}", SDLNet_GetError());
@@ -103,19 +136,20 @@ void Network::ReceiveFromServer() {
 
             receivedData.append(remoteDataReceived, len);
 
-            // Proess all complete packets
-            size_t delimiterPos = receivedData.find('\0');
+            // Process all complete packets, then drop them from the buffer in one go
+            size_t packetStart = 0;
+            size_t delimiterPos = receivedData.find('\0', scannedLength);
             while (delimiterPos != std::string::npos) {
-                // Extract the complete packet until the delimiter
-                std::string packet = receivedData.substr(0, delimiterPos);
-                // Remove the packet (including the delimiter) from the received data
-                receivedData.erase(0, delimiterPos + 1);
-                HandleRemoteJson(packet);
-                // Find the next delimiter
-                delimiterPos = receivedData.find('\0');
+                HandleRemoteJson(receivedData.substr(packetStart, delimiterPos - packetStart));
+                packetStart = delimiterPos + 1;
+                delimiterPos = receivedData.find('\0', packetStart);
             }
+            receivedData.erase(0, packetStart);
+            scannedLength = receivedData.size();
         }
 
+        SDLNet_FreeSocketSet(socketSet);
+
         if (isConnected) {
             SDLNet_TCP_Close(networkSocket);
             isConnected = false;
@@ -139,7 +173,37 @@ void Network::HandleRemoteJson(std::string payload) {
         return;
     }
 
-    OnIncomingJson(jsonPayload);
+    QueuePacket(std::move(jsonPayload));
+}
+
+// Receive thread only
+bool Network::QueuePacket(nlohmann::json&& packet) {
+    size_t tail = packetQueueTail.load(std::memory_order_relaxed);
+
+    // The game thread drains the queue every frame, so a full queue means it's stalled (loading, a breakpoint).
+    // Hold the packet rather than drop it, the socket buffers anything that arrives in the meantime.
+    while (tail - packetQueueHead.load(std::memory_order_acquire) == PacketQueueSize) {
+        if (!isEnabled) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    packetQueue[tail % PacketQueueSize] = std::move(packet);
+    packetQueueTail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+// Game thread only
+void Network::ProcessQueuedPackets() {
+    size_t head = packetQueueHead.load(std::memory_order_relaxed);
+    size_t tail = packetQueueTail.load(std::memory_order_acquire);
+
+    while (head != tail) {
+        nlohmann::json packet = std::move(packetQueue[head % PacketQueueSize]);
+        packetQueueHead.store(++head, std::memory_order_release);
+        OnIncomingJson(packet);
+    }
 }
 
 #endif // ENABLE_REMOTE_CONTROL
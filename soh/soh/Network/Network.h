@@ -3,6 +3,10 @@
 #define NETWORK_H
 #ifdef __cplusplus
 
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <thread>
 #include <SDL2/SDL_net.h>
 #include <nlohmann/json.hpp>
@@ -12,15 +16,30 @@ class Network {
     IPaddress networkAddress;
     TCPsocket networkSocket;
     std::thread receiveThread;
+    // Wakes the receive thread out of its reconnect backoff when the network is disabled
+    std::mutex enabledMutex;
+    std::condition_variable enabledChanged;
+
+    // Bytes received but not yet split into packets
     std::string receivedData;
 
+    // Parsed packets handed from the receive thread to the game thread. There is exactly one producer and one
+    // consumer, so the ring only needs its two indices to be atomic. The receive thread waits when it's full.
+    static const size_t PacketQueueSize = 256;
+    std::array<nlohmann::json, PacketQueueSize> packetQueue;
+    std::atomic<size_t> packetQueueHead = 0;
+    std::atomic<size_t> packetQueueTail = 0;
+    uint32_t onGameFrameUpdateHook = 0;
+
     void ReceiveFromServer();
     void HandleRemoteData(char payload[512]);
     void HandleRemoteJson(std::string payload);
+    bool QueuePacket(nlohmann::json&& packet);
+    void ProcessQueuedPackets();
 
   public:
-    bool isEnabled;
-    bool isConnected;
+    std::atomic<bool> isEnabled = false;
+    std::atomic<bool> isConnected = false;
 
     void Enable(const char* host, uint16_t port);
     void Disable();
@@ -35,8 +54,8 @@ class Network {
     /**
      * Json handler
      *
-     * This method will be called when a complete json packet is received. All json packets must
-     * be delimited by a null terminator (\0).
+     * This method will be called on the game thread, once per frame for each complete json packet
+     * received since the last frame. All json packets must be delimited by a null terminator (\0).
      */
     virtual void OnIncomingJson(nlohmann::json payload);
     virtual void OnConnected();
@@ -1,11 +1,26 @@
 #pragma once
+#include <atomic>
+#include <cstdint>
 #include <thread>
-#include <condition_variable>
 
-static struct {
+// Graph_ProcessGfxCommands requests one game frame of audio at a time. The audio thread reports back by
+// catching completedFrames up to requestedFrames, so neither side takes a lock to hand a frame over.
+struct OTRAudioState {
     std::thread thread;
-    std::condition_variable cv_to_thread, cv_from_thread;
-    std::mutex mutex;
-    bool running;
-    bool processing;
-} audio;
+    std::atomic<uint32_t> requestedFrames;
+    std::atomic<uint32_t> completedFrames;
+    std::atomic<bool> running;
+};
+
+inline OTRAudioState audio;
+
+// Blocks until the audio thread has finished every frame requested so far, after which it won't touch the
+// audio state again until the next request
+inline void OTRAudio_WaitForIdle() {
+    uint32_t requested = audio.requestedFrames.load(std::memory_order_acquire);
+    uint32_t completed = audio.completedFrames.load(std::memory_order_acquire);
+    while (completed != requested && audio.running.load(std::memory_order_acquire)) {
+        audio.completedFrames.wait(completed, std::memory_order_acquire);
+        completed = audio.completedFrames.load(std::memory_order_acquire);
+    }
+}
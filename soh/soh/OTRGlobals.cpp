@@ -36,6 +36,7 @@
 #include "Enhancements/gameplaystats.h"
 #include "Enhancements/n64_weird_frame_data.inc"
 #include "frame_interpolation.h"
+#include "cvar_handles.h"
 #include "variables.h"
 #include "z64.h"
 #include "macros.h"
@@ -387,12 +388,7 @@ OTRGlobals::OTRGlobals() {
     loader->RegisterResourceFactory(std::make_shared<SOH::ResourceFactoryBinaryBackgroundV0>(), RESOURCE_FORMAT_BINARY, "Background", static_cast<uint32_t>(SOH::ResourceType::SOH_Background), 0);
 
     gSaveStateMgr = std::make_shared<SaveStateMgr>();
-    gRandoContext->InitStaticData();
-    gRandoContext = Rando::Context::CreateInstance();
-    Rando::StaticData::InitItemTable();//RANDOTODO make this not rely on context's logic so it can be initialised in InitStaticData
-    gRandoContext->AddExcludedOptions();
-    gRandoContext->GetSettings()->CreateOptions();
-    gRandomizer = std::make_shared<Randomizer>();
+    InitRandomizer();
 
     hasMasterQuest = hasOriginal = false;
 
@@ -453,9 +449,27 @@ OTRGlobals::OTRGlobals() {
     }
 }
 
+OTRGlobals::OTRGlobals(bool hasOriginal, bool hasMasterQuest) {
+    context = Ship::Context::GetInstance();
+    InitRandomizer();
+
+    this->hasOriginal = hasOriginal;
+    this->hasMasterQuest = hasMasterQuest;
+    defaultFontSmaller = defaultFontLarger = defaultFontLargest = nullptr;
+}
+
 OTRGlobals::~OTRGlobals() {
 }
 
+void OTRGlobals::InitRandomizer() {
+    gRandoContext->InitStaticData();
+    gRandoContext = Rando::Context::CreateInstance();
+    Rando::StaticData::InitItemTable();//RANDOTODO make this not rely on context's logic so it can be initialised in InitStaticData
+    gRandoContext->AddExcludedOptions();
+    gRandoContext->GetSettings()->CreateOptions();
+    gRandomizer = std::make_shared<Randomizer>();
+}
+
 void OTRGlobals::ScaleImGui() {
     float scale = imguiScaleOptionToValue[CVarGetInteger(CVAR_SETTING("ImGuiScale"), defaultImGuiScale)];
     float newScale = scale / previousImGuiScale;
@@ -509,37 +523,41 @@ extern "C" int AudioPlayer_Buffered(void);
 extern "C" int AudioPlayer_GetDesiredBuffered(void);
 std::unordered_map<std::string, ExtensionEntry> ExtensionCache;
 
-void OTRAudio_Thread() {
-    while (audio.running) {
-        {
-            std::unique_lock<std::mutex> Lock(audio.mutex);
-            while (!audio.processing && audio.running) {
-                audio.cv_to_thread.wait(Lock);
-            }
+// 44KHZ values. One frame at 60 fps is 735 samples, and sample counts are kept to multiples of 16 around that.
+#define SAMPLES_NOMINAL 736
+#define SAMPLES_HIGH 752
+#define SAMPLES_LOW 720
+#define SAMPLES_STEP 16
 
-            if (!audio.running) {
-                break;
-            }
-        }
-        std::unique_lock<std::mutex> Lock(audio.mutex);
-        //AudioMgr_ThreadEntry(&gAudioMgr);
-        // 528 and 544 relate to 60 fps at 32 kHz 32000/60 = 533.333..
-        // in an ideal world, one third of the calls should use num_samples=544 and two thirds num_samples=528
-        //#define SAMPLES_HIGH 560
-        //#define SAMPLES_LOW 528
-        // PAL values
-        //#define SAMPLES_HIGH 656
-        //#define SAMPLES_LOW 624
+#define AUDIO_FRAMES_PER_UPDATE (R_UPDATE_RATE > 0 ? R_UPDATE_RATE : 1 )
+#define NUM_AUDIO_CHANNELS 2
 
-        // 44KHZ values
-        #define SAMPLES_HIGH 752
-        #define SAMPLES_LOW 720
+// Picks how many samples to synthesize per audio frame from how far the backend's buffer is from where it
+// wants to be. The rate is nudged in proportion to the error, and the part that doesn't fit the 16 sample
+// step is carried into the next frame, so the average rate settles instead of flipping between two sizes.
+static u32 OTRAudio_NextFrameSamples() {
+    static float carry = 0.0f;
 
-        #define AUDIO_FRAMES_PER_UPDATE (R_UPDATE_RATE > 0 ? R_UPDATE_RATE : 1 )
-        #define NUM_AUDIO_CHANNELS 2
+    float error = (float)(AudioPlayer_GetDesiredBuffered() - AudioPlayer_Buffered());
+    float correction = std::clamp(error / 64.0f, (float)(SAMPLES_LOW - SAMPLES_NOMINAL),
+                                  (float)(SAMPLES_HIGH - SAMPLES_NOMINAL));
+    float wanted = SAMPLES_NOMINAL + correction + carry;
+    float steps = std::round(wanted / SAMPLES_STEP);
+    u32 numSamples = std::clamp((u32)steps * SAMPLES_STEP, (u32)SAMPLES_LOW, (u32)SAMPLES_HIGH);
+    carry = std::clamp(wanted - numSamples, -(float)SAMPLES_STEP, (float)SAMPLES_STEP);
+    return numSamples;
+}
 
-        int samples_left = AudioPlayer_Buffered();
-        u32 num_audio_samples = samples_left < AudioPlayer_GetDesiredBuffered() ? SAMPLES_HIGH : SAMPLES_LOW;
+void OTRAudio_Thread() {
+    uint32_t completed = audio.completedFrames.load(std::memory_order_relaxed);
+    while (true) {
+        audio.requestedFrames.wait(completed, std::memory_order_acquire);
+        if (!audio.running.load(std::memory_order_acquire)) {
+            break;
+        }
+
+        //AudioMgr_ThreadEntry(&gAudioMgr);
+        u32 num_audio_samples = OTRAudio_NextFrameSamples();
 
         // 3 is the maximum authentic frame divisor.
         s16 audio_buffer[SAMPLES_HIGH * NUM_AUDIO_CHANNELS * 3];
@@ -549,8 +567,9 @@ void OTRAudio_Thread() {
 
         AudioPlayer_Play((u8*)audio_buffer, num_audio_samples * (sizeof(int16_t) * NUM_AUDIO_CHANNELS * AUDIO_FRAMES_PER_UPDATE));
 
-        audio.processing = false;
-        audio.cv_from_thread.notify_one();
+        completed++;
+        audio.completedFrames.store(completed, std::memory_order_release);
+        audio.completedFrames.notify_one();
     }
 }
 
@@ -568,11 +587,9 @@ extern "C" void OTRAudio_Init()
 
 extern "C" void OTRAudio_Exit() {
     // Tell the audio thread to stop
-    {
-        std::unique_lock<std::mutex> Lock(audio.mutex);
-        audio.running = false;
-    }
-    audio.cv_to_thread.notify_all();
+    audio.running.store(false, std::memory_order_release);
+    audio.requestedFrames.fetch_add(1, std::memory_order_release);
+    audio.requestedFrames.notify_one();
 
     // Wait until the audio thread quit
     audio.thread.join();
@@ -1010,7 +1027,10 @@ void DetectOTRVersion(std::string fileName, bool isMQ) {
                 Extractor::ShowErrorBox("Error", "An error occured, no OTR file was generated.\n\nExiting...");
                 exit(1);
             }
-            extract.CallZapd(installPath, Ship::Context::GetAppDirectoryPath(appShortName));
+            if (!extract.CallZapd(installPath, Ship::Context::GetAppDirectoryPath(appShortName))) {
+                Extractor::ShowErrorBox("Error", "Extraction failed, no OTR file was generated.\n\nExiting...");
+                exit(1);
+            }
         } else {
             exit(1);
         }
@@ -1106,7 +1126,10 @@ extern "C" void InitOTR() {
                 Extractor::ShowErrorBox("Error", "An error occured, no OTR file was generated.\n\nExiting...");
                 exit(1);
             }
-            extract.CallZapd(installPath, Ship::Context::GetAppDirectoryPath(appShortName));
+            if (!extract.CallZapd(installPath, Ship::Context::GetAppDirectoryPath(appShortName))) {
+                Extractor::ShowErrorBox("Error", "Extraction failed, no OTR file was generated.\n\nExiting...");
+                exit(1);
+            }
             generatedOtrIsMQ = extract.IsMasterQuest();
         } else {
             exit(1);
@@ -1115,8 +1138,8 @@ extern "C" void InitOTR() {
             Extractor extract;
             if (!extract.Run(Ship::Context::GetAppDirectoryPath(appShortName), generatedOtrIsMQ ? RomSearchMode::Vanilla : RomSearchMode::MQ)) {
                 Extractor::ShowErrorBox("Error", "An error occured, an OTR file may have been generated by a different step.\n\nContinuing...");
-            } else {
-                extract.CallZapd(installPath, Ship::Context::GetAppDirectoryPath(appShortName));
+            } else if (!extract.CallZapd(installPath, Ship::Context::GetAppDirectoryPath(appShortName))) {
+                Extractor::ShowErrorBox("Error", "Extraction failed, the second OTR file was not generated.\n\nContinuing...");
             }
         }
 
@@ -1263,6 +1286,8 @@ extern "C" uint64_t GetUnixTimestamp() {
 }
 
 extern "C" void Graph_StartFrame() {
+    CVarHandles_NewFrame();
+
 #ifndef __WIIU__
     using Ship::KbScancode;
     int32_t dwScancode = OTRGlobals::Instance->context->GetWindow()->GetLastScancode();
@@ -1335,6 +1360,14 @@ extern "C" void Graph_StartFrame() {
 
             break;
         }
+        case KbScancode::LUS_KB_F8: {
+            if (CVarGetInteger(CVAR_CHEAT("SaveStatesEnabled"), 0) == 0 ||
+                CVarGetInteger(CVAR_CHEAT("SaveStateRewind"), 0) == 0) {
+                return;
+            }
+            OTRGlobals::Instance->gSaveStateMgr->AddRequest({ REWIND_SLOT, RequestType::REWIND });
+            break;
+        }
 #if defined(_WIN32) || defined(__APPLE__)
         case KbScancode::LUS_KB_F9: {
             // Toggle TTS
@@ -1361,22 +1394,21 @@ extern "C" void Graph_StartFrame() {
     OTRGlobals::Instance->context->GetWindow()->StartFrame();
 }
 
-void RunCommands(Gfx* Commands, const std::vector<std::unordered_map<Mtx*, MtxF>>& mtx_replacements) {
-    for (const auto& m : mtx_replacements) {
-        gfx_run(Commands, m);
+void RunCommands(Gfx* Commands, const std::vector<std::unordered_map<Mtx*, MtxF>>& mtx_replacements, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        gfx_run(Commands, mtx_replacements[i]);
         gfx_end_frame();
     }
 }
 
 // C->C++ Bridge
 extern "C" void Graph_ProcessGfxCommands(Gfx* commands) {
-    {
-        std::unique_lock<std::mutex> Lock(audio.mutex);
-        audio.processing = true;
-    }
-
-    audio.cv_to_thread.notify_one();
-    std::vector<std::unordered_map<Mtx*, MtxF>> mtx_replacements;
+    audio.requestedFrames.fetch_add(1, std::memory_order_release);
+    audio.requestedFrames.notify_one();
+    // Kept across frames so the maps hold on to their buckets
+    static std::vector<std::unordered_map<Mtx*, MtxF>> mtx_replacements;
+    static std::vector<float> steps;
+    bool ends_on_original_frame = false;
     int target_fps = OTRGlobals::Instance->GetInterpolationFPS();
     static int last_fps;
     static int last_update_rate;
@@ -1396,15 +1428,27 @@ extern "C" void Graph_ProcessGfxCommands(Gfx* commands) {
     // time_base = fps * original_fps (one second)
     int next_original_frame = fps;
 
+    steps.clear();
     while (time + original_fps <= next_original_frame) {
         time += original_fps;
         if (time != next_original_frame) {
-            mtx_replacements.push_back(FrameInterpolation_Interpolate((float)time / next_original_frame));
+            steps.push_back((float)time / next_original_frame);
         } else {
-            mtx_replacements.emplace_back();
+            ends_on_original_frame = true;
         }
     }
 
+    // Every interpolated sub-frame is ready before the first one is drawn, then the original frame goes last
+    // with no replacements
+    if (mtx_replacements.size() < steps.size() + 1) {
+        mtx_replacements.resize(steps.size() + 1);
+    }
+    FrameInterpolation_Interpolate(steps, mtx_replacements);
+    size_t replacement_count = steps.size();
+    if (ends_on_original_frame) {
+        mtx_replacements[replacement_count++].clear();
+    }
+
     time -= fps;
 
     if (wnd != nullptr) {
@@ -1416,26 +1460,23 @@ extern "C" void Graph_ProcessGfxCommands(Gfx* commands) {
 
     // When the gfx debugger is active, only run with the final mtx
     if (GfxDebuggerIsDebugging()) {
-        mtx_replacements.clear();
-        mtx_replacements.emplace_back();
+        mtx_replacements[0].clear();
+        replacement_count = 1;
     }
 
-    RunCommands(commands, mtx_replacements);
+    RunCommands(commands, mtx_replacements, replacement_count);
 
     last_fps = fps;
     last_update_rate = R_UPDATE_RATE;
 
-    {
-        std::unique_lock<std::mutex> Lock(audio.mutex);
-        while (audio.processing) {
-            audio.cv_from_thread.wait(Lock);
-        }
-    }
+    // The next game frame queues audio commands, so the audio thread has to be done with this one first
+    OTRAudio_WaitForIdle();
 
     bool curAltAssets = CVarGetInteger(CVAR_ENHANCEMENT("AltAssets"), 0);
     if (prevAltAssets != curAltAssets) {
         prevAltAssets = curAltAssets;
         Ship::Context::GetInstance()->GetResourceManager()->SetAltAssetsEnabled(curAltAssets);
+        ResourceMgr_ClearResolvedResources();
         gfx_texture_cache_clear();
         SOH::SkeletonPatcher::UpdateSkeletons();
         GameInteractor::Instance->ExecuteHooks<GameInteractor::OnAssetAltChange>();
@@ -55,6 +55,8 @@ class OTRGlobals {
         ImFont* defaultFontLargest;
 
         OTRGlobals();
+        // Headless instance for tools that only need the randomizer, no window, audio or archives are loaded
+        OTRGlobals(bool hasOriginal, bool hasMasterQuest);
         ~OTRGlobals();
 
         void ScaleImGui();
@@ -66,6 +68,7 @@ class OTRGlobals {
 
     private:
     	void CheckSaveFile(size_t sramSize) const;
+        void InitRandomizer();
         bool hasMasterQuest;
         bool hasOriginal;
         ImFont* CreateDefaultFontWithSize(float size);
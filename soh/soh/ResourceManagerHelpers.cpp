@@ -14,8 +14,48 @@
 #include <Fast3D/gfx_pc.h>
 #include <DisplayList.h>
 
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <future>
+#include <mutex>
+
 extern "C" PlayState* gPlayState;
 
+// Resources resolved by the *ByName helpers, keyed on the path pointer since the draw path passes the same asset
+// symbols every frame. The text is still compared on lookup in case a buffer is reused for a different path.
+// Entries hold their resources, so they are cleared whenever resources are unloaded or alt assets are toggled.
+// Only the game thread resolves resources through here.
+struct ResolvedResource {
+    std::string path;
+    bool dependsOnMQ;
+    std::shared_ptr<Ship::IResource> resources[2]; // Indexed by whether the scene is Master Quest
+
+    ResolvedResource(const char* path) : path(path), dependsOnMQ(this->path.find("/nonmq/") != std::string::npos) {
+    }
+};
+
+static std::unordered_map<const char*, ResolvedResource> sResolvedResources;
+
+// Resources requested ahead of time, such as the rooms and scenes the player can walk into next. Loads run on the
+// resource manager's threads and are taken by the first load of the same path, so the game thread only blocks if
+// the player gets there before loading finishes. Requests are dropped oldest first past PREFETCH_CAPACITY.
+#define PREFETCH_CAPACITY 16
+
+struct PrefetchedResource {
+    std::string path;
+    std::shared_future<std::shared_ptr<Ship::IResource>> resource;
+};
+
+static std::deque<PrefetchedResource> sPrefetchedResources;
+
+// Sound fonts started loading in the background by AudioLoad_Init. Fonts are first used from the audio thread, so
+// the first use of one waits for its load here instead of loading it (and every sample in it) a second time.
+static std::mutex sAudioSoundFontLoadsMutex;
+static std::unordered_map<std::string, std::shared_future<std::shared_ptr<Ship::IResource>>> sAudioSoundFontLoads;
+// Size of sAudioSoundFontLoads, so the audio thread's font lookups skip the mutex once every load has been claimed
+static std::atomic<size_t> sAudioSoundFontLoadsPending = 0;
+
 extern "C" uint32_t ResourceMgr_GetNumGameVersions() {
     return Ship::Context::GetInstance()->GetResourceManager()->GetArchiveManager()->GetGameVersions().size();
 }
@@ -122,9 +162,15 @@ extern "C" void ResourceMgr_LoadDirectory(const char* resName) {
 
 extern "C" void ResourceMgr_DirtyDirectory(const char* resName) {
     Ship::Context::GetInstance()->GetResourceManager()->DirtyDirectory(resName);
+    ResourceMgr_ClearResolvedResources();
 }
 
-extern "C" void ResourceMgr_UnloadResource(const char* resName) {
+extern "C" void ResourceMgr_UnloadDirectory(const char* resName) {
+    Ship::Context::GetInstance()->GetResourceManager()->UnloadDirectory(resName);
+    ResourceMgr_ClearResolvedResources();
+}
+
+static void UnloadResourceByName(const char* resName) {
     std::string path = resName;
     if (path.substr(0, 7) == "__OTR__") {
         path = path.substr(7);
@@ -132,6 +178,65 @@ extern "C" void ResourceMgr_UnloadResource(const char* resName) {
     auto res = Ship::Context::GetInstance()->GetResourceManager()->UnloadResource(path);
 }
 
+extern "C" void ResourceMgr_UnloadResource(const char* resName) {
+    UnloadResourceByName(resName);
+    ResourceMgr_ClearResolvedResources();
+}
+
+extern "C" void ResourceMgr_ClearResolvedResources() {
+    sResolvedResources.clear();
+    sPrefetchedResources.clear();
+
+    std::lock_guard<std::mutex> lock(sAudioSoundFontLoadsMutex);
+    sAudioSoundFontLoads.clear();
+    sAudioSoundFontLoadsPending.store(0, std::memory_order_release);
+}
+
+void ResourceMgr_PrefetchResource(const std::string& path) {
+    auto it = std::find_if(sPrefetchedResources.begin(), sPrefetchedResources.end(),
+                           [&path](const PrefetchedResource& prefetched) { return prefetched.path == path; });
+    if (it != sPrefetchedResources.end()) {
+        // Already requested, just keep it around for longer
+        PrefetchedResource prefetched = std::move(*it);
+        sPrefetchedResources.erase(it);
+        sPrefetchedResources.push_back(std::move(prefetched));
+        return;
+    }
+
+    if (sPrefetchedResources.size() >= PREFETCH_CAPACITY) {
+        sPrefetchedResources.pop_front();
+    }
+    sPrefetchedResources.push_back(
+        { path, Ship::Context::GetInstance()->GetResourceManager()->LoadResourceAsync(path) });
+}
+
+std::shared_ptr<Ship::IResource> ResourceMgr_TakePrefetchedResource(const std::string& path) {
+    auto it = std::find_if(sPrefetchedResources.begin(), sPrefetchedResources.end(),
+                           [&path](const PrefetchedResource& prefetched) { return prefetched.path == path; });
+    if (it == sPrefetchedResources.end()) {
+        return nullptr;
+    }
+
+    auto resource = it->resource;
+    sPrefetchedResources.erase(it);
+    return resource.get();
+}
+
+static std::string GetPathHandlingMQ(const char* path) {
+    std::string Path = path;
+    if (ResourceMgr_IsGameMasterQuest()) {
+        size_t pos = Path.find("/nonmq/", 0);
+        if (pos != std::string::npos) {
+            Path.replace(pos, 7, "/mq/");
+        }
+    }
+    return Path;
+}
+
+extern "C" void ResourceMgr_PrefetchResourceByNameHandlingMQ(const char* path) {
+    ResourceMgr_PrefetchResource(GetPathHandlingMQ(path));
+}
+
 // OTRTODO: There is probably a more elegant way to go about this...
 // Kenix: This is definitely leaking memory when it's called.
 extern "C" char** ResourceMgr_ListFiles(const char* searchMask, int* resultSize) {
@@ -177,25 +282,44 @@ extern "C" bool ResourceMgr_IsAltAssetsEnabled() {
 
 // Unloads a resource if an alternate version exists when alt assets are enabled
 // The resource is only removed from the internal cache to prevent it from used in the next resource lookup
+// Resolved resources are left alone, as this runs right before the path itself is resolved
 extern "C" void ResourceMgr_UnloadOriginalWhenAltExists(const char* resName) {
     if (ResourceMgr_IsAltAssetsEnabled() && ResourceMgr_FileAltExists((char*)resName)) {
-        ResourceMgr_UnloadResource((char*) resName);
+        UnloadResourceByName(resName);
     }
 }
 
-std::shared_ptr<Ship::IResource> ResourceMgr_GetResourceByNameHandlingMQ(const char* path) {
-    std::string Path = path;
-    if (ResourceMgr_IsGameMasterQuest()) {
-        size_t pos = 0;
-        if ((pos = Path.find("/nonmq/", 0)) != std::string::npos) {
-            Path.replace(pos, 7, "/mq/");
+// Every helper resolves through here, so the original is unloaded when an alt exists no matter which helper
+// resolves a path first. Otherwise the original would stay cached and be drawn instead of the alt.
+static const std::shared_ptr<Ship::IResource>& GetResolvedResource(const char* path) {
+    auto it = sResolvedResources.find(path);
+    if (it == sResolvedResources.end() || it->second.path != path) {
+        it = sResolvedResources.insert_or_assign(path, ResolvedResource(path)).first;
+    }
+
+    ResolvedResource& resolved = it->second;
+    bool isMQ = resolved.dependsOnMQ && ResourceMgr_IsGameMasterQuest();
+    std::shared_ptr<Ship::IResource>& res = resolved.resources[isMQ];
+    if (res == nullptr) {
+        std::string Path = resolved.path;
+        if (isMQ) {
+            Path.replace(Path.find("/nonmq/", 0), 7, "/mq/");
+        }
+        ResourceMgr_UnloadOriginalWhenAltExists(Path.c_str());
+        res = ResourceMgr_TakePrefetchedResource(Path);
+        if (res == nullptr) {
+            res = Ship::Context::GetInstance()->GetResourceManager()->LoadResource(Path.c_str());
         }
     }
-    return Ship::Context::GetInstance()->GetResourceManager()->LoadResource(Path.c_str());
+    return res;
+}
+
+std::shared_ptr<Ship::IResource> ResourceMgr_GetResourceByNameHandlingMQ(const char* path) {
+    return GetResolvedResource(path);
 }
 
 extern "C" char* ResourceMgr_GetResourceDataByNameHandlingMQ(const char* path) {
-    auto res = ResourceMgr_GetResourceByNameHandlingMQ(path);
+    const auto& res = GetResolvedResource(path);
 
     if (res == nullptr) {
         return nullptr;
@@ -251,24 +375,24 @@ extern "C" char* ResourceMgr_LoadJPEG(char* data, size_t dataSize) {
 }
 
 extern "C" char* ResourceMgr_LoadTexOrDListByName(const char* filePath) {
-    auto res = ResourceMgr_GetResourceByNameHandlingMQ(filePath);
+    const auto& res = GetResolvedResource(filePath);
 
     if (res->GetInitData()->Type == static_cast<uint32_t>(LUS::ResourceType::DisplayList)) {
-        return (char*)&((std::static_pointer_cast<LUS::DisplayList>(res))->Instructions[0]);
+        return (char*)&(static_cast<LUS::DisplayList*>(res.get())->Instructions[0]);
     }
 
     if (res->GetInitData()->Type == static_cast<uint32_t>(SOH::ResourceType::SOH_Array)) {
-        return (char*)(std::static_pointer_cast<SOH::Array>(res))->Vertices.data();
+        return (char*)static_cast<SOH::Array*>(res.get())->Vertices.data();
     }
 
-    return (char*)ResourceMgr_GetResourceDataByNameHandlingMQ(filePath);
+    return (char*)res->GetRawPointer();
 }
 
 extern "C" char* ResourceMgr_LoadIfDListByName(const char* filePath) {
-    auto res = ResourceMgr_GetResourceByNameHandlingMQ(filePath);
+    const auto& res = GetResolvedResource(filePath);
 
     if (res->GetInitData()->Type == static_cast<uint32_t>(LUS::ResourceType::DisplayList)) {
-        return (char*)&((std::static_pointer_cast<LUS::DisplayList>(res))->Instructions[0]);
+        return (char*)&(static_cast<LUS::DisplayList*>(res.get())->Instructions[0]);
     }
 
     return nullptr;
@@ -285,13 +409,12 @@ extern "C" void ResourceMgr_PushCurrentDirectory(char* path) {
 }
 
 extern "C" Gfx* ResourceMgr_LoadGfxByName(const char* path) {
-    // When an alt resource exists for the DL, we need to unload the original asset
+    // When an alt resource exists for the DL, resolving it unloads the original asset
     // to clear the cache so the alt asset will be loaded instead
-    // OTRTODO: If Alt loading over original cache is fixed, this line can most likely be removed
-    ResourceMgr_UnloadOriginalWhenAltExists(path);
-
-    auto res = std::static_pointer_cast<LUS::DisplayList>(ResourceMgr_GetResourceByNameHandlingMQ(path));
-    return (Gfx*)&res->Instructions[0];
+    // This only has to happen before the DL is first resolved, as toggling alt assets clears resolved resources
+    // OTRTODO: If Alt loading over original cache is fixed, this can most likely be removed
+    const auto& res = GetResolvedResource(path);
+    return (Gfx*)&static_cast<LUS::DisplayList*>(res.get())->Instructions[0];
 }
 
 extern "C" uint8_t ResourceMgr_FileIsCustomByName(const char* path) {
@@ -306,11 +429,16 @@ typedef struct {
 
 std::unordered_map<std::string, std::unordered_map<std::string, GfxPatch>> originalGfx;
 
+// Patches go through the same resolved resources as ResourceMgr_LoadGfxByName, so the display list that gets patched
+// is the one being drawn, and cosmetics rewriting their patches every frame don't look the resource up by name again
+static LUS::DisplayList* GetPatchableDisplayList(const char* path) {
+    return static_cast<LUS::DisplayList*>(GetResolvedResource(path).get());
+}
+
 // Attention! This is primarily for cosmetics & bug fixes. For things like mods and model replacement you should be using OTRs
 // instead (When that is available). Index can be found using the commented out section below.
 extern "C" void ResourceMgr_PatchGfxByName(const char* path, const char* patchName, int index, Gfx instruction) {
-    auto res = std::static_pointer_cast<LUS::DisplayList>(
-        Ship::Context::GetInstance()->GetResourceManager()->LoadResource(path));
+    auto res = GetPatchableDisplayList(path);
 
     // Leaving this here for people attempting to find the correct Dlist index to patch
     /*if (strcmp("__OTR__objects/object_gi_longsword/gGiBiggoronSwordDL", path) == 0) {
@@ -337,19 +465,14 @@ extern "C" void ResourceMgr_PatchGfxByName(const char* path, const char* patchNa
 
     Gfx* gfx = (Gfx*)&res->Instructions[index];
 
-    if (!originalGfx.contains(path) || !originalGfx[path].contains(patchName)) {
-        originalGfx[path][patchName] = {
-            index,
-            *gfx
-        };
-    }
+    // Only the first patch under a name records the original instruction
+    originalGfx[path].try_emplace(patchName, GfxPatch{ index, *gfx });
 
     *gfx = instruction;
 }
 
 extern "C" void ResourceMgr_PatchGfxCopyCommandByName(const char* path, const char* patchName, int destinationIndex, int sourceIndex) {
-    auto res = std::static_pointer_cast<LUS::DisplayList>(
-        Ship::Context::GetInstance()->GetResourceManager()->LoadResource(path));
+    auto res = GetPatchableDisplayList(path);
 
     // Do not patch custom assets as they most likely do not have the same instructions as authentic assets
     if (res->GetInitData()->IsCustom) {
@@ -359,26 +482,26 @@ extern "C" void ResourceMgr_PatchGfxCopyCommandByName(const char* path, const ch
     Gfx* destinationGfx = (Gfx*)&res->Instructions[destinationIndex];
     Gfx sourceGfx = *(Gfx*)&res->Instructions[sourceIndex];
 
-    if (!originalGfx.contains(path) || !originalGfx[path].contains(patchName)) {
-        originalGfx[path][patchName] = {
-            destinationIndex,
-            *destinationGfx
-        };
-    }
+    originalGfx[path].try_emplace(patchName, GfxPatch{ destinationIndex, *destinationGfx });
 
     *destinationGfx = sourceGfx;
 }
 
 extern "C" void ResourceMgr_UnpatchGfxByName(const char* path, const char* patchName) {
-    if (originalGfx.contains(path) && originalGfx[path].contains(patchName)) {
-        auto res = std::static_pointer_cast<LUS::DisplayList>(
-            Ship::Context::GetInstance()->GetResourceManager()->LoadResource(path));
+    auto pathPatches = originalGfx.find(path);
+    if (pathPatches == originalGfx.end()) {
+        return;
+    }
+    auto patch = pathPatches->second.find(patchName);
+    if (patch == pathPatches->second.end()) {
+        return;
+    }
 
-        Gfx* gfx = (Gfx*)&res->Instructions[originalGfx[path][patchName].index];
-        *gfx = originalGfx[path][patchName].instruction;
+    auto res = GetPatchableDisplayList(path);
+    Gfx* gfx = (Gfx*)&res->Instructions[patch->second.index];
+    *gfx = patch->second.instruction;
 
-        originalGfx[path].erase(patchName);
-    }
+    pathPatches->second.erase(patch);
 }
 
 extern "C" char* ResourceMgr_LoadArrayByName(const char* path) {
@@ -414,7 +537,8 @@ extern "C" CollisionHeader* ResourceMgr_LoadColByName(const char* path) {
 }
 
 extern "C" Vtx* ResourceMgr_LoadVtxByName(char* path) {
-    return (Vtx*) ResourceGetDataByName(path);
+    const auto& res = GetResolvedResource(path);
+    return res != nullptr ? (Vtx*)res->GetRawPointer() : nullptr;
 }
 
 extern "C" SequenceData ResourceMgr_LoadSeqByName(const char* path) {
@@ -427,9 +551,79 @@ extern "C" SoundFontSample* ResourceMgr_LoadAudioSample(const char* path) {
 }
 
 extern "C" SoundFont* ResourceMgr_LoadAudioSoundFont(const char* path) {
+    std::shared_future<std::shared_ptr<Ship::IResource>> pendingLoad;
+    if (sAudioSoundFontLoadsPending.load(std::memory_order_acquire) != 0) {
+        std::lock_guard<std::mutex> lock(sAudioSoundFontLoadsMutex);
+        auto it = sAudioSoundFontLoads.find(path);
+        if (it != sAudioSoundFontLoads.end()) {
+            pendingLoad = std::move(it->second);
+            sAudioSoundFontLoads.erase(it);
+            sAudioSoundFontLoadsPending.store(sAudioSoundFontLoads.size(), std::memory_order_release);
+        }
+    }
+    if (pendingLoad.valid()) {
+        // Once it's done the resource manager has it cached, so the lookup below won't load it again
+        pendingLoad.wait();
+    }
+
     return (SoundFont*) ResourceGetDataByName(path);
 }
 
+extern "C" void ResourceMgr_LoadAudioSoundFontsAsync(char** paths, int count) {
+    auto resourceManager = Ship::Context::GetInstance()->GetResourceManager();
+
+    std::lock_guard<std::mutex> lock(sAudioSoundFontLoadsMutex);
+    for (int i = 0; i < count; i++) {
+        if (!sAudioSoundFontLoads.contains(paths[i])) {
+            sAudioSoundFontLoads.emplace(paths[i], resourceManager->LoadResourceAsync(paths[i]));
+        }
+    }
+    sAudioSoundFontLoadsPending.store(sAudioSoundFontLoads.size(), std::memory_order_release);
+}
+
+// Opens the file a resource would be read from, positioned after its header, without running its factory. Returns
+// nullptr for anything that isn't a binary resource of the given type, which callers handle by loading it fully.
+static std::shared_ptr<Ship::BinaryReader> OpenBinaryResourceHeader(const char* path, SOH::ResourceType type) {
+    std::string filePath = path;
+    if (ResourceMgr_IsAltAssetsEnabled() && ResourceMgr_FileAltExists(path)) {
+        filePath = Ship::IResource::gAltAssetPrefix + filePath;
+    }
+
+    auto file = Ship::Context::GetInstance()->GetResourceManager()->LoadFile(filePath);
+    if (file == nullptr || !file->IsLoaded || file->InitData == nullptr ||
+        file->InitData->Format != RESOURCE_FORMAT_BINARY || file->InitData->Type != static_cast<uint32_t>(type) ||
+        !std::holds_alternative<std::shared_ptr<Ship::BinaryReader>>(file->Reader)) {
+        return nullptr;
+    }
+    return std::get<std::shared_ptr<Ship::BinaryReader>>(file->Reader);
+}
+
+extern "C" int32_t ResourceMgr_GetAudioSoundFontIndex(const char* path) {
+    auto reader = OpenBinaryResourceHeader(path, SOH::ResourceType::SOH_AudioSoundFont);
+    if (reader == nullptr) {
+        return ResourceMgr_LoadAudioSoundFont(path)->fntIndex;
+    }
+
+    // Same layout ResourceFactoryBinaryAudioSoundFontV2 reads
+    return reader->ReadInt32();
+}
+
+extern "C" SequenceData ResourceMgr_LoadSeqHeaderByName(const char* path) {
+    auto reader = OpenBinaryResourceHeader(path, SOH::ResourceType::SOH_AudioSequence);
+    if (reader == nullptr) {
+        return ResourceMgr_LoadSeqByName(path);
+    }
+
+    // Same layout ResourceFactoryBinaryAudioSequenceV2 reads, skipping over the sequence data itself
+    SequenceData sequence = {};
+    int32_t seqDataSize = reader->ReadInt32();
+    reader->Seek(seqDataSize, Ship::SeekOffsetType::Current);
+    sequence.seqNumber = reader->ReadUByte();
+    sequence.medium = reader->ReadUByte();
+    sequence.cachePolicy = reader->ReadUByte();
+    return sequence;
+}
+
 extern "C" int ResourceMgr_OTRSigCheck(char* imgData) {
 	uintptr_t i = (uintptr_t)(imgData);
 
@@ -456,7 +650,8 @@ extern "C" int ResourceMgr_OTRSigCheck(char* imgData) {
 }
 
 extern "C" AnimationHeaderCommon* ResourceMgr_LoadAnimByName(const char* path) {
-    return (AnimationHeaderCommon*) ResourceGetDataByName(path);
+    const auto& res = GetResolvedResource(path);
+    return res != nullptr ? (AnimationHeaderCommon*)res->GetRawPointer() : nullptr;
 }
 
 extern "C" SkeletonHeader* ResourceMgr_LoadSkeletonByName(const char* path, SkelAnime* skelAnime) {
@@ -10,9 +10,13 @@
 
 #ifdef __cplusplus
 #include <memory>
+#include <string>
 #include <Resource.h>
 
 std::shared_ptr<Ship::IResource> ResourceMgr_GetResourceByNameHandlingMQ(const char* path);
+// Starts loading a resource in the background; returns what finished loading for a path that was prefetched
+void ResourceMgr_PrefetchResource(const std::string& path);
+std::shared_ptr<Ship::IResource> ResourceMgr_TakePrefetchedResource(const std::string& path);
 
 extern "C" {
 #endif // __cplusplus
@@ -29,6 +33,10 @@ extern "C" {
     uint32_t ResourceMgr_GetGameRegion(int index);
     void ResourceMgr_LoadDirectory(const char* resName);
     void ResourceMgr_UnloadResource(const char* resName);
+    void ResourceMgr_UnloadDirectory(const char* resName);
+    // Drops resources the *ByName helpers have resolved, so their next lookup goes back to the resource manager
+    void ResourceMgr_ClearResolvedResources();
+    void ResourceMgr_PrefetchResourceByNameHandlingMQ(const char* path);
     char** ResourceMgr_ListFiles(const char* searchMask, int* resultSize);
     uint8_t ResourceMgr_FileExists(const char* resName);
     uint8_t ResourceMgr_FileAltExists(const char* resName);
@@ -51,6 +59,11 @@ extern "C" {
     Vtx* ResourceMgr_LoadVtxByCRC(uint64_t crc);
     Vtx* ResourceMgr_LoadVtxByName(char* path);
     SoundFont* ResourceMgr_LoadAudioSoundFont(const char* path);
+    // Starts loading sound fonts on the resource manager's threads; ResourceMgr_LoadAudioSoundFont waits for them
+    void ResourceMgr_LoadAudioSoundFontsAsync(char** paths, int count);
+    // Read only the metadata at the start of a font or sequence, leaving the samples and sequence data unloaded
+    int32_t ResourceMgr_GetAudioSoundFontIndex(const char* path);
+    SequenceData ResourceMgr_LoadSeqHeaderByName(const char* path);
     SequenceData ResourceMgr_LoadSeqByName(const char* path);
     SoundFontSample* ResourceMgr_LoadAudioSample(const char* path);
     CollisionHeader* ResourceMgr_LoadColByName(const char* path);
@@ -23,6 +23,8 @@
 #include <fstream>
 #include <filesystem>
 #include <array>
+#include <cstring>
+#include <iterator>
 #include <mutex>
 
 extern "C" SaveContext gSaveContext;
@@ -1150,6 +1152,179 @@ int copy_file(const char* src, const char* dst) {
 }
 #endif
 
+// Binary saves are a journal of section records, each holding the section's {"version", "data"} block as
+// MessagePack. Saving appends records only for the sections that changed since they were last written, and loading
+// replays them in order so the last record for a section wins. A record cut short by a crash is ignored on load.
+//   header: "SOHJ" u32 journalVersion
+//   record: u32 nameSize, name, u32 dataSize, data
+// All integers are little endian.
+static const char sSaveJournalMagic[4] = { 'S', 'O', 'H', 'J' };
+static const uint32_t sSaveJournalVersion = 1;
+// Rewrite the journal once superseded records outnumber the live ones by this much
+static const size_t sSaveJournalCompactRatio = 2;
+
+static void WriteJournalU32(std::ofstream& output, uint32_t value) {
+    uint8_t bytes[4] = { (uint8_t)value, (uint8_t)(value >> 8), (uint8_t)(value >> 16), (uint8_t)(value >> 24) };
+    output.write((const char*)bytes, sizeof(bytes));
+}
+
+static void WriteJournalRecord(std::ofstream& output, const std::string& name, const std::vector<uint8_t>& data) {
+    WriteJournalU32(output, name.size());
+    output.write(name.data(), name.size());
+    WriteJournalU32(output, data.size());
+    output.write((const char*)data.data(), data.size());
+}
+
+static bool ReadJournalU32(const std::vector<uint8_t>& journal, size_t& pos, uint32_t& value) {
+    if (journal.size() - pos < 4) {
+        return false;
+    }
+    value = journal[pos] | (journal[pos + 1] << 8) | (journal[pos + 2] << 16) | ((uint32_t)journal[pos + 3] << 24);
+    pos += 4;
+    return true;
+}
+
+static bool IsBinarySave(const std::filesystem::path& fileName) {
+    std::ifstream input(fileName, std::ios::binary);
+    char magic[sizeof(sSaveJournalMagic)] = {};
+    input.read(magic, sizeof(magic));
+    return input.gcount() == sizeof(magic) && memcmp(magic, sSaveJournalMagic, sizeof(magic)) == 0;
+}
+
+// Swaps the fully written temp file in for the save, so an interrupted write never leaves a partial save behind
+void SaveManager::ReplaceSaveWithTemp(int fileNum) {
+    std::filesystem::path fileName = GetFileName(fileNum);
+    std::filesystem::path tempFile = GetFileTempName(fileNum);
+
+    if (std::filesystem::exists(fileName)) {
+        std::filesystem::remove(fileName);
+    }
+
+#if defined(__SWITCH__) || defined(__WIIU__)
+    copy_file(tempFile.c_str(), fileName.c_str());
+#else
+    std::filesystem::copy_file(tempFile, fileName);
+#endif
+
+    if (std::filesystem::exists(tempFile)) {
+        std::filesystem::remove(tempFile);
+    }
+}
+
+void SaveManager::WriteJsonSave(int fileNum) {
+    std::filesystem::path tempFile = GetFileTempName(fileNum);
+
+    if (std::filesystem::exists(tempFile)) {
+        std::filesystem::remove(tempFile);
+    }
+
+#if defined(__SWITCH__) || defined(__WIIU__)
+    FILE* w = fopen(tempFile.c_str(), "w");
+    std::string json_string = saveBlock.dump(4);
+    fwrite(json_string.c_str(), sizeof(char), json_string.length(), w);
+    fclose(w);
+#else
+    std::ofstream output(tempFile);
+    output << std::setw(4) << saveBlock << std::endl;
+    output.close();
+#endif
+
+    ReplaceSaveWithTemp(fileNum);
+    saveJournal.fileNum = -1;
+}
+
+void SaveManager::WriteBinarySave(int fileNum) {
+    std::vector<std::pair<std::string, std::vector<uint8_t>>> changedSections;
+    for (auto& section : saveBlock["sections"].items()) {
+        std::vector<uint8_t> data = nlohmann::json::to_msgpack(section.value());
+        auto written = saveJournal.sections.find(section.key());
+        if (saveJournal.fileNum != fileNum || written == saveJournal.sections.end() || written->second != data) {
+            changedSections.emplace_back(section.key(), std::move(data));
+        }
+    }
+
+    std::filesystem::path fileName = GetFileName(fileNum);
+    bool canAppend = saveJournal.fileNum == fileNum && std::filesystem::exists(fileName);
+    if (canAppend && changedSections.empty()) {
+        return;
+    }
+
+    if (canAppend && saveJournal.records + changedSections.size() <=
+                         saveJournal.sections.size() * (sSaveJournalCompactRatio + 1)) {
+        std::ofstream output(fileName, std::ios::binary | std::ios::app);
+        for (auto& [name, data] : changedSections) {
+            WriteJournalRecord(output, name, data);
+            saveJournal.sections[name] = std::move(data);
+        }
+        saveJournal.records += changedSections.size();
+        return;
+    }
+
+    // Compact: write every section once into a fresh journal. This runs inline in the save task on the save thread
+    // pool, so it blocks later saves but never the game thread.
+    if (saveJournal.fileNum != fileNum) {
+        saveJournal.sections.clear();
+    }
+    for (auto& [name, data] : changedSections) {
+        saveJournal.sections[name] = std::move(data);
+    }
+
+    std::filesystem::path tempFile = GetFileTempName(fileNum);
+    {
+        std::ofstream output(tempFile, std::ios::binary | std::ios::trunc);
+        output.write(sSaveJournalMagic, sizeof(sSaveJournalMagic));
+        WriteJournalU32(output, sSaveJournalVersion);
+        for (auto& [name, data] : saveJournal.sections) {
+            WriteJournalRecord(output, name, data);
+        }
+    }
+    ReplaceSaveWithTemp(fileNum);
+
+    saveJournal.fileNum = fileNum;
+    saveJournal.records = saveJournal.sections.size();
+}
+
+// Rebuilds saveBlock from a binary save, in the same shape a JSON save is parsed into. complete is false when the
+// file ends in a partial record, which must not be appended to.
+bool SaveManager::ReadBinarySave(const std::filesystem::path& fileName, bool& complete) {
+    std::ifstream input(fileName, std::ios::binary);
+    std::vector<uint8_t> journal((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+
+    size_t pos = sizeof(sSaveJournalMagic);
+    uint32_t journalVersion;
+    if (journal.size() < pos || !ReadJournalU32(journal, pos, journalVersion) ||
+        journalVersion != sSaveJournalVersion) {
+        return false;
+    }
+
+    saveJournal.sections.clear();
+    saveJournal.records = 0;
+    uint32_t nameSize;
+    uint32_t dataSize;
+    size_t recordStart = pos;
+    while (ReadJournalU32(journal, pos, nameSize) && journal.size() - pos >= nameSize) {
+        std::string name((const char*)&journal[pos], nameSize);
+        pos += nameSize;
+        if (!ReadJournalU32(journal, pos, dataSize) || journal.size() - pos < dataSize) {
+            SPDLOG_WARN("Save " + fileName.string() + " ends with an incomplete " + name + " section, ignoring it");
+            break;
+        }
+        saveJournal.sections[name].assign(journal.begin() + pos, journal.begin() + pos + dataSize);
+        saveJournal.records++;
+        pos += dataSize;
+        recordStart = pos;
+    }
+    complete = recordStart == journal.size();
+
+    saveBlock = nlohmann::json::object();
+    saveBlock["version"] = 1;
+    saveBlock["sections"] = nlohmann::json::object();
+    for (auto& [name, data] : saveJournal.sections) {
+        saveBlock["sections"][name] = nlohmann::json::from_msgpack(data);
+    }
+    return true;
+}
+
 // Threaded SaveFile takes copy of gSaveContext for local unmodified storage
 
 void SaveManager::SaveFileThreaded(int fileNum, SaveContext* saveContext, int sectionID) {
@@ -1189,36 +1364,10 @@ void SaveManager::SaveFileThreaded(int fileNum, SaveContext* saveContext, int se
         svi.func(saveContext, sectionID, false);
     }
 
-    std::filesystem::path fileName = GetFileName(fileNum);
-    std::filesystem::path tempFile = GetFileTempName(fileNum);
-
-    if (std::filesystem::exists(tempFile)) {
-        std::filesystem::remove(tempFile);
-    }
-
-#if defined(__SWITCH__) || defined(__WIIU__)
-    FILE* w = fopen(tempFile.c_str(), "w");
-    std::string json_string = saveBlock.dump(4);
-    fwrite(json_string.c_str(), sizeof(char), json_string.length(), w);
-    fclose(w);
-#else
-    std::ofstream output(tempFile);
-    output << std::setw(4) << saveBlock << std::endl;
-    output.close();
-#endif
-
-    if (std::filesystem::exists(fileName)) {
-        std::filesystem::remove(fileName);
-    }
-
-#if defined(__SWITCH__) || defined(__WIIU__)
-    copy_file(tempFile.c_str(), fileName.c_str());
-#else
-    std::filesystem::copy_file(tempFile, fileName);
-#endif
-
-    if (std::filesystem::exists(tempFile)) {
-        std::filesystem::remove(tempFile);
+    if (CVarGetInteger(CVAR_ENHANCEMENT("BinarySaveFiles"), 0)) {
+        WriteBinarySave(fileNum);
+    } else {
+        WriteJsonSave(fileNum);
     }
 
     delete saveContext;
@@ -1278,7 +1427,20 @@ void SaveManager::LoadFile(int fileNum) {
     
     try {
         saveBlock = nlohmann::json::object();
-        input >> saveBlock;
+        saveJournal.fileNum = -1;
+        if (IsBinarySave(fileName)) {
+            bool complete;
+            if (!ReadBinarySave(fileName, complete)) {
+                throw std::runtime_error("Unrecognized binary save version");
+            }
+            // Appending after a partial record would make the next load read it together with the new one, so
+            // leave fileNum unset and let the next save compact the journal instead
+            if (complete) {
+                saveJournal.fileNum = fileNum;
+            }
+        } else {
+            input >> saveBlock;
+        }
         if (!saveBlock.contains("version")) {
             SPDLOG_ERROR("Save at " + fileName.string() + " contains no version");
             assert(false);
@@ -2462,9 +2624,15 @@ void SaveManager::CopyZeldaFile(int from, int to) {
 }
 
 void SaveManager::DeleteZeldaFile(int fileNum) {
+    // Threaded saves write the file and the journal under saveMtx, so wait for one in flight to finish first
+    saveMtx.lock();
     if (std::filesystem::exists(GetFileName(fileNum))) {
         std::filesystem::remove(GetFileName(fileNum));
     }
+    if (saveJournal.fileNum == fileNum) {
+        saveJournal.fileNum = -1;
+    }
+    saveMtx.unlock();
     fileMetaInfo[fileNum].valid = false;
     fileMetaInfo[fileNum].randoSave = false;
     fileMetaInfo[fileNum].requiresMasterQuest = false;
@@ -38,6 +38,7 @@ typedef struct {
 #include <map>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <functional>
 #include <vector>
 #include <filesystem>
@@ -152,6 +153,10 @@ class SaveManager {
     void CreateDefaultGlobal();
 
     void SaveFileThreaded(int fileNum, SaveContext* saveContext, int sectionID);
+    void WriteJsonSave(int fileNum);
+    void WriteBinarySave(int fileNum);
+    bool ReadBinarySave(const std::filesystem::path& fileName, bool& complete);
+    void ReplaceSaveWithTemp(int fileNum);
 
     void InitMeta(int slotNum);
     static void InitFileImpl(bool isDebug);
@@ -188,6 +193,14 @@ class SaveManager {
     nlohmann::json::iterator currentJsonArrayContext;
     std::shared_ptr<BS::thread_pool> smThreadPool;
     std::mutex saveMtx;
+
+    // What the binary save on disk for fileNum holds: the last record written for each section and how many records
+    // the file has in total, superseded ones included. fileNum is -1 when there is no binary save to append to.
+    struct SaveJournal {
+        int fileNum = -1;
+        std::unordered_map<std::string, std::vector<uint8_t>> sections;
+        size_t records = 0;
+    } saveJournal;
 };
 
 #else
@@ -1659,6 +1659,11 @@ void DrawEnhancementsMenu() {
         UIWidgets::EnhancementCombobox(CVAR_ENHANCEMENT("Autosave"), autosaveLabels, AUTOSAVE_OFF);
         UIWidgets::Tooltip("Automatically save the game when changing locations and/or obtaining items\n"
             "Major items exclude rupees and health/magic/ammo refills (but include bombchus unless bombchu drops are enabled)");
+        UIWidgets::PaddedEnhancementCheckbox("Binary Save Files", CVAR_ENHANCEMENT("BinarySaveFiles"), true, false);
+        UIWidgets::Tooltip("Write save files in a compact binary format that only records what changed since the last save, "
+            "instead of rewriting the whole file as JSON\n\n"
+            "Existing saves of either format keep loading, and are converted the next time they are saved. "
+            "Turn this off to convert a save back to JSON.");
 
         UIWidgets::PaddedSeparator(true, true, 2.0f, 2.0f);
 
@@ -1791,6 +1796,19 @@ void DrawCheatsMenu() {
                 UIWidgets::PaddedEnhancementCheckbox("I understand, enable save states", CVAR_CHEAT("SaveStatesEnabled"), true,
                                                      false);
                 UIWidgets::Tooltip("F5 to save, F6 to change slots, F7 to load");
+                if (CVarGetInteger(CVAR_CHEAT("SaveStatesEnabled"), 0) == 1) {
+                    UIWidgets::PaddedEnhancementCheckbox("Rewind", CVAR_CHEAT("SaveStateRewind"), true, false);
+                    UIWidgets::Tooltip("Keeps a state every few frames. Hold F8 to step back through them");
+                    if (CVarGetInteger(CVAR_CHEAT("SaveStateRewind"), 0) == 1) {
+                        UIWidgets::PaddedEnhancementSliderInt("Rewind Every %d Frames", "##SaveStateRewindInterval",
+                                                              CVAR_CHEAT("SaveStateRewindInterval"), 1, 20, "", 1, true,
+                                                              true, false);
+                        UIWidgets::PaddedEnhancementSliderInt("Rewind Memory: %d MB", "##SaveStateRewindMemory",
+                                                              CVAR_CHEAT("SaveStateRewindMemory"), 32, 2048, "", 256,
+                                                              true, true, false);
+                        UIWidgets::Tooltip("Older states are dropped once the rewind buffer reaches this size");
+                    }
+                }
             }
 
             ImGui::EndMenu();
@@ -0,0 +1,40 @@
+#include "cvar_handles.h"
+
+#include <libultraship/libultraship.h>
+
+#include <memory>
+#include <vector>
+
+struct ResolvedCVar {
+    std::shared_ptr<Ship::CVar> cvar;
+    uint32_t frame;
+};
+
+static std::vector<ResolvedCVar> sResolvedCVars;
+static uint32_t sFrame = 1;
+
+extern "C" int32_t CVarHandle_GetInteger(CVarHandle* handle) {
+    if (handle->slot < 0) {
+        handle->slot = (int32_t)sResolvedCVars.size();
+        sResolvedCVars.push_back({ nullptr, 0 });
+    }
+
+    ResolvedCVar& resolved = sResolvedCVars[handle->slot];
+    if (resolved.frame != sFrame) {
+        // Values are set in place, so a CVar only needs looking up again when it didn't exist yet or the console
+        // variables dropped their reference to it
+        if (resolved.cvar == nullptr || resolved.cvar.use_count() == 1) {
+            resolved.cvar = Ship::Context::GetInstance()->GetConsoleVariables()->Get(handle->name);
+        }
+        resolved.frame = sFrame;
+    }
+
+    if (resolved.cvar != nullptr && resolved.cvar->Type == Ship::ConsoleVariableType::Integer) {
+        return resolved.cvar->Integer;
+    }
+    return handle->defaultValue;
+}
+
+extern "C" void CVarHandles_NewFrame(void) {
+    sFrame++;
+}
@@ -0,0 +1,31 @@
+#ifndef CVAR_HANDLES_H
+#define CVAR_HANDLES_H
+
+#include <stdint.h>
+
+// A CVar name resolved once to its console variable, for reads in per-actor and per-frame code. Declare handles
+// at file scope so each one is registered on first use and reused after that:
+//   static CVarHandle sDrawDistance = CVAR_HANDLE(CVAR_ENHANCEMENT("DisableDrawDistance"), 1);
+//   s32 multiplier = CVarHandle_GetInteger(&sDrawDistance);
+// Values set through CVarSet* are seen immediately. CVars that are created, cleared or reloaded are picked up at
+// the start of the next frame. Handles are only read from the game thread.
+typedef struct {
+    const char* name;
+    int32_t defaultValue;
+    int32_t slot; // Registry index, -1 until the first read
+} CVarHandle;
+
+#define CVAR_HANDLE(name, defaultValue) { name, defaultValue, -1 }
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int32_t CVarHandle_GetInteger(CVarHandle* handle);
+void CVarHandles_NewFrame(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -1,7 +1,10 @@
 #include <libultraship/bridge.h>
+#include <BS_thread_pool.hpp>
 
+#include <algorithm>
+#include <array>
+#include <thread>
 #include <vector>
-#include <map>
 #include <unordered_map>
 #include <math.h>
 
@@ -35,6 +38,11 @@ inserted FrameInterpolation_OpenChild/FrameInterpolation_Close child calls.
 These nodes contain information that should suffice to identify the matrix,
 so we can find it in an adjacent frame.
 
+The tree is stored flat: nodes, instructions and their data live in vectors
+that are cleared rather than freed between frames, and nodes/instructions
+refer to each other by index. Once the vectors have grown to the size of a
+busy scene, recording a frame doesn't allocate.
+
 We can interpolate an arbitrary amount of frames between two original frames,
 given a specific interpolation factor (0=old frame, 0.5=average of frames,
 1.0=new frame).
@@ -77,6 +85,9 @@ MtxF* Matrix_GetCurrent(void);
 
 void SkinMatrix_MtxFMtxFMult(MtxF* mfA, MtxF* mfB, MtxF* dest);
 
+extern thread_local MtxF* sMatrixStack;
+extern thread_local MtxF* sCurrentMatrix;
+
 }
 
 static bool invert_matrix(const float m[16], float invOut[16]);
@@ -103,9 +114,15 @@ namespace {
         MatrixToMtx,
         MatrixReplaceRotation,
         MatrixRotateAxis,
-        SkinMatrixMtxFToMtx
+        SkinMatrixMtxFToMtx,
+
+        Count
     };
 
+    constexpr size_t OP_COUNT = (size_t)Op::Count;
+    constexpr uint32_t NONE = UINT32_MAX;
+    constexpr size_t MATRIX_STACK_SIZE = 20; // Same as Matrix_Init
+
     typedef pair<const void*, int> label;
 
     union Data {
@@ -169,25 +186,129 @@ namespace {
             Vec3f axis;
             u8 mode;
         } matrix_rotate_axis;
+    };
 
-        struct {
-            label key;
-            size_t idx;
-        } open_child;
+    // An instruction recorded into a node. A node's items are chained in recording order, and its items of
+    // the same Op are chained separately so the nth Op of a kind can be matched against an adjacent frame.
+    struct Item {
+        Op op;
+        uint32_t next;
+        uint32_t next_same_op;
+        uint32_t index; // Into Recording::data, or Recording::nodes for OpenChild
     };
 
-    struct Path {
-        map<label, vector<Path>> children;
-        map<Op, vector<Data>> ops;
-        vector<pair<Op, size_t>> items;
+    struct Node {
+        label key;
+        uint32_t idx; // Number of earlier siblings with the same key
+        uint32_t first_item = NONE;
+        uint32_t last_item = NONE;
+        array<uint32_t, OP_COUNT> first_op;
+        array<uint32_t, OP_COUNT> last_op;
+
+        Node(label key, uint32_t idx) : key(key), idx(idx) {
+            first_op.fill(NONE);
+            last_op.fill(NONE);
+        }
+    };
+
+    // Open addressing table from (parent node, key, idx) to a child node. Entries with idx == NONE count
+    // the children of a parent with that key instead. Clearing bumps the generation, so slots are kept
+    // and never need to be touched.
+    class ChildTable {
+      public:
+        const uint32_t* find(uint32_t parent, label key, uint32_t idx) const {
+            if (slots.empty()) {
+                return nullptr;
+            }
+            for (size_t i = hash(parent, key, idx) & (slots.size() - 1);; i = (i + 1) & (slots.size() - 1)) {
+                const Slot& slot = slots[i];
+                if (slot.generation != generation) {
+                    return nullptr;
+                }
+                if (slot.parent == parent && slot.key == key && slot.idx == idx) {
+                    return &slot.value;
+                }
+            }
+        }
+
+        // Returns the existing value, or a new one set to 0
+        uint32_t& insert(uint32_t parent, label key, uint32_t idx) {
+            if ((used + 1) * 2 > slots.size()) {
+                grow();
+            }
+            for (size_t i = hash(parent, key, idx) & (slots.size() - 1);; i = (i + 1) & (slots.size() - 1)) {
+                Slot& slot = slots[i];
+                if (slot.generation != generation) {
+                    slot = { generation, parent, idx, key, 0 };
+                    used++;
+                    return slot.value;
+                }
+                if (slot.parent == parent && slot.key == key && slot.idx == idx) {
+                    return slot.value;
+                }
+            }
+        }
+
+        void clear() {
+            used = 0;
+            if (++generation == 0) {
+                fill(slots.begin(), slots.end(), Slot{});
+                generation = 1;
+            }
+        }
+
+      private:
+        struct Slot {
+            uint32_t generation = 0;
+            uint32_t parent;
+            uint32_t idx;
+            label key;
+            uint32_t value;
+        };
+
+        vector<Slot> slots;
+        uint32_t generation = 1;
+        size_t used = 0;
+
+        static size_t hash(uint32_t parent, label key, uint32_t idx) {
+            uint64_t h = (uint64_t)(uintptr_t)key.first;
+            h = (h ^ (uint32_t)key.second) * 0x9E3779B97F4A7C15ull;
+            h = (h ^ parent) * 0x9E3779B97F4A7C15ull;
+            h = (h ^ idx) * 0x9E3779B97F4A7C15ull;
+            return (size_t)(h ^ (h >> 32));
+        }
+
+        void grow() {
+            vector<Slot> old_slots(max<size_t>(slots.size() * 2, 1024));
+            old_slots.swap(slots);
+            uint32_t old_generation = generation;
+            generation = 1;
+            used = 0;
+            for (const Slot& slot : old_slots) {
+                if (slot.generation == old_generation) {
+                    insert(slot.parent, slot.key, slot.idx) = slot.value;
+                }
+            }
+        }
     };
 
     struct Recording {
-        Path root_path;
+        vector<Node> nodes; // nodes[0] is the root
+        vector<Item> items;
+        vector<Data> data;
+        ChildTable children;
+
+        void clear() {
+            nodes.clear();
+            items.clear();
+            data.clear();
+            children.clear();
+            nodes.emplace_back(label{ nullptr, 0 }, 0);
+        }
     };
 
     bool is_recording;
-    vector<Path*> current_path;
+    vector<uint32_t> current_path;
     uint32_t camera_epoch;
     uint32_t previous_camera_epoch;
     Recording current_recording;
@@ -198,16 +319,37 @@ namespace {
     MtxF inv_actor_mtx;
     size_t inv_actor_mtx_path_index;
 
+    void append_item(Op op, uint32_t index) {
+        Recording& r = current_recording;
+        Node& node = r.nodes[current_path.back()];
+        uint32_t item = (uint32_t)r.items.size();
+        r.items.push_back({ op, NONE, NONE, index });
+
+        if (node.last_item != NONE) {
+            r.items[node.last_item].next = item;
+        } else {
+            node.first_item = item;
+        }
+        node.last_item = item;
+
+        size_t o = (size_t)op;
+        if (node.last_op[o] != NONE) {
+            r.items[node.last_op[o]].next_same_op = item;
+        } else {
+            node.first_op[o] = item;
+        }
+        node.last_op[o] = item;
+    }
+
     Data& append(Op op) {
-        auto& m = current_path.back()->ops[op];
-        current_path.back()->items.emplace_back(op, m.size());
-        return m.emplace_back();
+        append_item(op, (uint32_t)current_recording.data.size());
+        return current_recording.data.emplace_back();
     }
 
     struct InterpolateCtx {
         float step;
         float w;
-        unordered_map<Mtx*, MtxF> mtx_replacements;
+        unordered_map<Mtx*, MtxF>& mtx_replacements;
         MtxF tmp_mtxf, tmp_mtxf2;
         Vec3f tmp_vec3f;
         Vec3s tmp_vec3s;
@@ -295,163 +437,206 @@ namespace {
             res->z = interpolate_angle(o->z, n->z);
         }
 
-        void interpolate_branch(Path* old_path, Path *new_path) {
-            for (auto& item : new_path->items) {
-                Data& new_op = new_path->ops[item.first][item.second];
+        void interpolate_branch(Recording& old_rec, uint32_t old_node, Recording& new_rec, uint32_t new_node) {
+            // The nth Op of a kind in the new node is matched with the nth of that kind in the old one, so walk
+            // the old node's per-Op chains alongside
+            array<uint32_t, OP_COUNT> old_cursor = old_rec.nodes[old_node].first_op;
+
+            for (uint32_t i = new_rec.nodes[new_node].first_item; i != NONE; i = new_rec.items[i].next) {
+                const Item& item = new_rec.items[i];
+                uint32_t old_item = old_cursor[(size_t)item.op];
+                if (old_item != NONE) {
+                    old_cursor[(size_t)item.op] = old_rec.items[old_item].next_same_op;
+                }
 
-                if (item.first == Op::OpenChild) {
-                    if (auto it = old_path->children.find(new_op.open_child.key);
-                        it != old_path->children.end() && new_op.open_child.idx < it->second.size()) {
-                        interpolate_branch(&it->second[new_op.open_child.idx],
-                                            &new_path->children.find(new_op.open_child.key)->second[new_op.open_child.idx]);
+                if (item.op == Op::OpenChild) {
+                    const Node& child = new_rec.nodes[item.index];
+                    if (const uint32_t* old_child = old_rec.children.find(old_node, child.key, child.idx)) {
+                        interpolate_branch(old_rec, *old_child, new_rec, item.index);
                     } else {
-                        interpolate_branch(
-                            &new_path->children.find(new_op.open_child.key)->second[new_op.open_child.idx],
-                            &new_path->children.find(new_op.open_child.key)->second[new_op.open_child.idx]);
+                        interpolate_branch(new_rec, item.index, new_rec, item.index);
                     }
                     continue;
                 }
 
-                if (auto it = old_path->ops.find(item.first); it != old_path->ops.end()) {
-                    if (item.second < it->second.size()) {
-                        Data& old_op = it->second[item.second];
-                        switch (item.first) {
-                            case Op::OpenChild:
-                                break;
-                            case Op::CloseChild:
-                                break;
-
-                            case Op::MatrixPush:
-                                Matrix_Push();
-                                break;
-
-                            case Op::MatrixPop:
-                                Matrix_Pop();
-                                break;
-
-                            case Op::MatrixPut:
-                                interpolate_mtxf(&tmp_mtxf, &old_op.matrix_put.src, &new_op.matrix_put.src);
-                                Matrix_Put(&tmp_mtxf);
-                                break;
-
-                            case Op::MatrixMult:
-                                interpolate_mtxf(&tmp_mtxf, &old_op.matrix_mult.mf, &new_op.matrix_mult.mf);
-                                Matrix_Mult(&tmp_mtxf, new_op.matrix_mult.mode);
-                                break;
-
-                            case Op::MatrixTranslate:
-                                Matrix_Translate(lerp(old_op.matrix_translate.x, new_op.matrix_translate.x),
-                                                 lerp(old_op.matrix_translate.y, new_op.matrix_translate.y),
-                                                 lerp(old_op.matrix_translate.z, new_op.matrix_translate.z),
-                                                 new_op.matrix_translate.mode);
-                                break;
-
-                            case Op::MatrixScale:
-                                Matrix_Scale(lerp(old_op.matrix_scale.x, new_op.matrix_scale.x),
-                                             lerp(old_op.matrix_scale.y, new_op.matrix_scale.y),
-                                             lerp(old_op.matrix_scale.z, new_op.matrix_scale.z),
-                                             new_op.matrix_scale.mode);
-                                break;
-
-                            case Op::MatrixRotate1Coord: {
-                                float v = interpolate_angle(old_op.matrix_rotate_1_coord.value, new_op.matrix_rotate_1_coord.value);
-                                u8 mode = new_op.matrix_rotate_1_coord.mode;
-                                switch (new_op.matrix_rotate_1_coord.coord) {
-                                    case 0:
-                                        Matrix_RotateX(v, mode);
-                                        break;
-
-                                    case 1:
-                                        Matrix_RotateY(v, mode);
-                                        break;
-
-                                    case 2:
-                                        Matrix_RotateZ(v, mode);
-                                        break;
-                                }
-                                break;
-                            }
-
-                            case Op::MatrixRotateZYX:
-                                Matrix_RotateZYX(interpolate_angle(old_op.matrix_rotate_zyx.x, new_op.matrix_rotate_zyx.x),
-                                                 interpolate_angle(old_op.matrix_rotate_zyx.y, new_op.matrix_rotate_zyx.y),
-                                                 interpolate_angle(old_op.matrix_rotate_zyx.z, new_op.matrix_rotate_zyx.z),
-                                                 new_op.matrix_rotate_zyx.mode);
-                                break;
+                if (old_item == NONE) {
+                    continue;
+                }
 
-                            case Op::MatrixTranslateRotateZYX:
-                                lerp_vec3f(&tmp_vec3f, &old_op.matrix_translate_rotate_zyx.translation, &new_op.matrix_translate_rotate_zyx.translation);
-                                interpolate_angles(&tmp_vec3s, &old_op.matrix_translate_rotate_zyx.rotation, &new_op.matrix_translate_rotate_zyx.rotation);
-                                Matrix_TranslateRotateZYX(&tmp_vec3f, &tmp_vec3s);
+                Data& new_op = new_rec.data[item.index];
+                Data& old_op = old_rec.data[old_rec.items[old_item].index];
+                switch (item.op) {
+                    case Op::OpenChild:
+                        break;
+                    case Op::CloseChild:
+                        break;
+
+                    case Op::MatrixPush:
+                        Matrix_Push();
+                        break;
+
+                    case Op::MatrixPop:
+                        Matrix_Pop();
+                        break;
+
+                    case Op::MatrixPut:
+                        interpolate_mtxf(&tmp_mtxf, &old_op.matrix_put.src, &new_op.matrix_put.src);
+                        Matrix_Put(&tmp_mtxf);
+                        break;
+
+                    case Op::MatrixMult:
+                        interpolate_mtxf(&tmp_mtxf, &old_op.matrix_mult.mf, &new_op.matrix_mult.mf);
+                        Matrix_Mult(&tmp_mtxf, new_op.matrix_mult.mode);
+                        break;
+
+                    case Op::MatrixTranslate:
+                        Matrix_Translate(lerp(old_op.matrix_translate.x, new_op.matrix_translate.x),
+                                         lerp(old_op.matrix_translate.y, new_op.matrix_translate.y),
+                                         lerp(old_op.matrix_translate.z, new_op.matrix_translate.z),
+                                         new_op.matrix_translate.mode);
+                        break;
+
+                    case Op::MatrixScale:
+                        Matrix_Scale(lerp(old_op.matrix_scale.x, new_op.matrix_scale.x),
+                                     lerp(old_op.matrix_scale.y, new_op.matrix_scale.y),
+                                     lerp(old_op.matrix_scale.z, new_op.matrix_scale.z),
+                                     new_op.matrix_scale.mode);
+                        break;
+
+                    case Op::MatrixRotate1Coord: {
+                        float v = interpolate_angle(old_op.matrix_rotate_1_coord.value, new_op.matrix_rotate_1_coord.value);
+                        u8 mode = new_op.matrix_rotate_1_coord.mode;
+                        switch (new_op.matrix_rotate_1_coord.coord) {
+                            case 0:
+                                Matrix_RotateX(v, mode);
                                 break;
 
-                            case Op::MatrixSetTranslateRotateYXZ:
-                                interpolate_angles(&tmp_vec3s, &old_op.matrix_set_translate_rotate_yxz.rot,
-                                                               &new_op.matrix_set_translate_rotate_yxz.rot);
-                                Matrix_SetTranslateRotateYXZ(lerp(old_op.matrix_set_translate_rotate_yxz.translateX,
-                                                                  new_op.matrix_set_translate_rotate_yxz.translateX),
-                                                             lerp(old_op.matrix_set_translate_rotate_yxz.translateY,
-                                                                  new_op.matrix_set_translate_rotate_yxz.translateY),
-                                                             lerp(old_op.matrix_set_translate_rotate_yxz.translateZ,
-                                                                  new_op.matrix_set_translate_rotate_yxz.translateZ),
-                                                             &tmp_vec3s);
-                                if (new_op.matrix_set_translate_rotate_yxz.has_mtx && old_op.matrix_set_translate_rotate_yxz.has_mtx) {
-                                    actor_mtx = *Matrix_GetCurrent();
-                                }
+                            case 1:
+                                Matrix_RotateY(v, mode);
                                 break;
 
-                            case Op::MatrixMtxFToMtx:
-                                interpolate_mtxf(new_replacement(new_op.matrix_mtxf_to_mtx.dest),
-                                                 &old_op.matrix_mtxf_to_mtx.src, &new_op.matrix_mtxf_to_mtx.src);
+                            case 2:
+                                Matrix_RotateZ(v, mode);
                                 break;
+                        }
+                        break;
+                    }
 
-                            case Op::MatrixToMtx: {
-                                //*new_replacement(new_op.matrix_to_mtx.dest) = *Matrix_GetCurrent();
-                                if (old_op.matrix_to_mtx.has_adjusted && new_op.matrix_to_mtx.has_adjusted) {
-                                    interpolate_mtxf(&tmp_mtxf, &old_op.matrix_to_mtx.src, &new_op.matrix_to_mtx.src);
-                                    SkinMatrix_MtxFMtxFMult(&actor_mtx, &tmp_mtxf, new_replacement(new_op.matrix_to_mtx.dest));
-                                } else {
-                                    interpolate_mtxf(new_replacement(new_op.matrix_to_mtx.dest),
-                                                     &old_op.matrix_to_mtx.src, &new_op.matrix_to_mtx.src);
-                                }
-                                break;
-                            }
+                    case Op::MatrixRotateZYX:
+                        Matrix_RotateZYX(interpolate_angle(old_op.matrix_rotate_zyx.x, new_op.matrix_rotate_zyx.x),
+                                         interpolate_angle(old_op.matrix_rotate_zyx.y, new_op.matrix_rotate_zyx.y),
+                                         interpolate_angle(old_op.matrix_rotate_zyx.z, new_op.matrix_rotate_zyx.z),
+                                         new_op.matrix_rotate_zyx.mode);
+                        break;
+
+                    case Op::MatrixTranslateRotateZYX:
+                        lerp_vec3f(&tmp_vec3f, &old_op.matrix_translate_rotate_zyx.translation, &new_op.matrix_translate_rotate_zyx.translation);
+                        interpolate_angles(&tmp_vec3s, &old_op.matrix_translate_rotate_zyx.rotation, &new_op.matrix_translate_rotate_zyx.rotation);
+                        Matrix_TranslateRotateZYX(&tmp_vec3f, &tmp_vec3s);
+                        break;
+
+                    case Op::MatrixSetTranslateRotateYXZ:
+                        interpolate_angles(&tmp_vec3s, &old_op.matrix_set_translate_rotate_yxz.rot,
+                                                       &new_op.matrix_set_translate_rotate_yxz.rot);
+                        Matrix_SetTranslateRotateYXZ(lerp(old_op.matrix_set_translate_rotate_yxz.translateX,
+                                                          new_op.matrix_set_translate_rotate_yxz.translateX),
+                                                     lerp(old_op.matrix_set_translate_rotate_yxz.translateY,
+                                                          new_op.matrix_set_translate_rotate_yxz.translateY),
+                                                     lerp(old_op.matrix_set_translate_rotate_yxz.translateZ,
+                                                          new_op.matrix_set_translate_rotate_yxz.translateZ),
+                                                     &tmp_vec3s);
+                        if (new_op.matrix_set_translate_rotate_yxz.has_mtx && old_op.matrix_set_translate_rotate_yxz.has_mtx) {
+                            actor_mtx = *Matrix_GetCurrent();
+                        }
+                        break;
+
+                    case Op::MatrixMtxFToMtx:
+                        interpolate_mtxf(new_replacement(new_op.matrix_mtxf_to_mtx.dest),
+                                         &old_op.matrix_mtxf_to_mtx.src, &new_op.matrix_mtxf_to_mtx.src);
+                        break;
+
+                    case Op::MatrixToMtx: {
+                        //*new_replacement(new_op.matrix_to_mtx.dest) = *Matrix_GetCurrent();
+                        if (old_op.matrix_to_mtx.has_adjusted && new_op.matrix_to_mtx.has_adjusted) {
+                            interpolate_mtxf(&tmp_mtxf, &old_op.matrix_to_mtx.src, &new_op.matrix_to_mtx.src);
+                            SkinMatrix_MtxFMtxFMult(&actor_mtx, &tmp_mtxf, new_replacement(new_op.matrix_to_mtx.dest));
+                        } else {
+                            interpolate_mtxf(new_replacement(new_op.matrix_to_mtx.dest),
+                                             &old_op.matrix_to_mtx.src, &new_op.matrix_to_mtx.src);
+                        }
+                        break;
+                    }
 
-                            case Op::MatrixReplaceRotation:
-                                interpolate_mtxf(&tmp_mtxf, &old_op.matrix_replace_rotation.mf, &new_op.matrix_replace_rotation.mf);
-                                Matrix_ReplaceRotation(&tmp_mtxf);
-                                break;
+                    case Op::MatrixReplaceRotation:
+                        interpolate_mtxf(&tmp_mtxf, &old_op.matrix_replace_rotation.mf, &new_op.matrix_replace_rotation.mf);
+                        Matrix_ReplaceRotation(&tmp_mtxf);
+                        break;
 
-                            case Op::MatrixRotateAxis:
-                                lerp_vec3f(&tmp_vec3f, &old_op.matrix_rotate_axis.axis, &new_op.matrix_rotate_axis.axis);
-                                Matrix_RotateAxis(interpolate_angle(old_op.matrix_rotate_axis.angle, new_op.matrix_rotate_axis.angle),
-                                                  &tmp_vec3f, new_op.matrix_rotate_axis.mode);
-                                break;
+                    case Op::MatrixRotateAxis:
+                        lerp_vec3f(&tmp_vec3f, &old_op.matrix_rotate_axis.axis, &new_op.matrix_rotate_axis.axis);
+                        Matrix_RotateAxis(interpolate_angle(old_op.matrix_rotate_axis.angle, new_op.matrix_rotate_axis.angle),
+                                          &tmp_vec3f, new_op.matrix_rotate_axis.mode);
+                        break;
 
-                            case Op::SkinMatrixMtxFToMtx:
-                                break;
-                        }
-                    }
+                    case Op::SkinMatrixMtxFToMtx:
+                    case Op::Count:
+                        break;
                 }
             }
         }
     };
 
+    void interpolate(float step, unordered_map<Mtx*, MtxF>& mtx_replacements) {
+        mtx_replacements.clear();
+        InterpolateCtx ctx{ step, 1.0f - step, mtx_replacements };
+        ctx.interpolate_branch(previous_recording, 0, current_recording, 0);
+    }
+
+    BS::thread_pool& interpolation_pool() {
+        static BS::thread_pool pool(clamp(thread::hardware_concurrency() / 2, 1u, 4u));
+        return pool;
+    }
+
 } // anonymous namespace
 
-unordered_map<Mtx*, MtxF> FrameInterpolation_Interpolate(float step) {
-    InterpolateCtx ctx;
-    ctx.step = step;
-    ctx.w = 1.0f - step;
-    ctx.interpolate_branch(&previous_recording.root_path, &current_recording.root_path);
-    return ctx.mtx_replacements;
+void FrameInterpolation_Interpolate(const vector<float>& steps, vector<unordered_map<Mtx*, MtxF>>& mtx_replacements) {
+    if (current_recording.nodes.empty()) {
+        for (size_t i = 0; i < steps.size(); i++) {
+            mtx_replacements[i].clear();
+        }
+        return;
+    }
+    if (previous_recording.nodes.empty()) {
+        previous_recording.clear();
+    }
+
+    if (steps.size() == 1) {
+        interpolate(steps[0], mtx_replacements[0]);
+        return;
+    }
+
+    // Sub-frames only read the recordings, so each can be replayed on its own worker. The Matrix_ functions
+    // work on a thread local stack, which each worker points at its own copy starting from the game's
+    // current matrix, as a lone sub-frame on this thread would.
+    MtxF current = *Matrix_GetCurrent();
+    interpolation_pool()
+        .submit_loop<size_t>(0, steps.size(),
+                             [&](size_t i) {
+                                 MtxF stack[MATRIX_STACK_SIZE];
+                                 stack[0] = current;
+                                 sMatrixStack = sCurrentMatrix = stack;
+                                 interpolate(steps[i], mtx_replacements[i]);
+                                 sMatrixStack = sCurrentMatrix = nullptr;
+                             })
+        .wait();
 }
 
 void FrameInterpolation_StartRecord(void) {
-    previous_recording = move(current_recording);
-    current_recording = {};
+    // Swapping keeps both recordings' buffers, so neither has to grow again next frame
+    swap(previous_recording, current_recording);
+    current_recording.clear();
     current_path.clear();
-    current_path.push_back(&current_recording.root_path);
+    current_path.push_back(0);
     if (OTRGlobals::Instance->GetInterpolationFPS() != 20) {
         is_recording = true;
     }
@@ -466,9 +651,14 @@ void FrameInterpolation_RecordOpenChild(const void* a, int b) {
     if (!is_recording)
         return;
     label key = { a, b };
-    auto& m = current_path.back()->children[key];
-    append(Op::OpenChild).open_child = { key, m.size() };
-    current_path.push_back(&m.emplace_back());
+    Recording& r = current_recording;
+    uint32_t parent = current_path.back();
+    uint32_t idx = r.children.insert(parent, key, NONE)++;
+    uint32_t child = (uint32_t)r.nodes.size();
+    r.nodes.emplace_back(key, idx);
+    r.children.insert(parent, key, idx) = child;
+    append_item(Op::OpenChild, child);
+    current_path.push_back(child);
 }
 
 void FrameInterpolation_RecordCloseChild(void) {
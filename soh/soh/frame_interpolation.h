@@ -5,8 +5,12 @@
 #ifdef __cplusplus
 
 #include <unordered_map>
+#include <vector>
 
-std::unordered_map<Mtx*, MtxF> FrameInterpolation_Interpolate(float step);
+// Interpolates each step into the map at the same index, replacing its contents so callers can keep the maps
+// around to reuse their buckets. mtx_replacements must hold at least as many maps as there are steps.
+void FrameInterpolation_Interpolate(const std::vector<float>& steps,
+                                   std::vector<std::unordered_map<Mtx*, MtxF>>& mtx_replacements);
 
 extern "C" {
 
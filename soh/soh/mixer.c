@@ -8,6 +8,67 @@
 #pragma GCC optimize ("unroll-loops")
 #endif
 
+// SSE2 and NEON are part of the x86-64 and AArch64 baselines, so the vector paths are picked at compile time.
+// Every vector path produces the same samples as the scalar code it replaces.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MIXER_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define MIXER_NEON
+#include <arm_neon.h>
+#endif
+
+// AVX2 isn't part of the baseline, so its paths are built with a target attribute and picked at runtime. Only
+// aMix and aAddMixer use it: they stream whole buffers, while the other kernels work on 8 sample blocks that
+// depend on the block before them (ADPCM, the filter), or on per block state (resampling, the envelope ramp).
+#if defined(MIXER_SSE2) && (defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER))
+#define MIXER_AVX2
+#include <immintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+#define MIXER_AVX2_TARGET __attribute__((target("avx2")))
+#else
+#define MIXER_AVX2_TARGET
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+static bool mixer_cpu_has_avx2(void) {
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+        return false;
+    }
+    // The OS has to save the YMM registers as well, OSXSAVE plus the XCR0 SSE and AVX state bits
+    __cpuid(info, 1);
+    if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0 || (_xgetbv(0) & 6) != 6) {
+        return false;
+    }
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+// Only the audio thread mixes, so the result is cached without a lock
+static bool mixer_use_avx2(void) {
+    static int8_t has_avx2 = -1;
+    if (has_avx2 < 0) {
+        has_avx2 = mixer_cpu_has_avx2() ? 1 : 0;
+    }
+    return has_avx2 != 0;
+}
+
+// The scalar loops read in[i] before writing out[i], so a vector of 16 samples only matches them when it
+// can't read samples it has yet to write
+static inline bool mixer_avx2_no_overlap(const int16_t* in, const int16_t* out) {
+    return out <= in || out - in >= 16;
+}
+#endif
+
 #define ROUND_UP_64(v) (((v) + 63) & ~63)
 #define ROUND_UP_32(v) (((v) + 31) & ~31)
 #define ROUND_UP_16(v) (((v) + 15) & ~15)
@@ -94,6 +155,22 @@ static inline int32_t clamp32(int64_t v) {
     return (int32_t)v;
 }
 
+#if defined(MIXER_SSE2)
+// (s * vol) >> 16 for signed samples and an unsigned volume. mulhi is signed only, so volumes from 0x8000 up
+// come out 0x10000 short, which is s in the high half.
+static inline __m128i mulhi_vol(__m128i s, uint16_t vol) {
+    __m128i r = _mm_mulhi_epi16(s, _mm_set1_epi16((int16_t)vol));
+    return (vol & 0x8000) ? _mm_add_epi16(r, s) : r;
+}
+#elif defined(MIXER_NEON)
+static inline int16x8_t mulhi_vol(int16x8_t s, uint16_t vol) {
+    int32x4_t v = vdupq_n_s32(vol);
+    int32x4_t lo = vshrq_n_s32(vmulq_s32(vmovl_s16(vget_low_s16(s)), v), 16);
+    int32x4_t hi = vshrq_n_s32(vmulq_s32(vmovl_s16(vget_high_s16(s)), v), 16);
+    return vcombine_s16(vmovn_s32(lo), vmovn_s32(hi));
+}
+#endif
+
 void aClearBufferImpl(uint16_t addr, int nbytes) {
     nbytes = ROUND_UP_16(nbytes);
     memset(BUF_U8(addr), 0, nbytes);
@@ -128,6 +205,26 @@ void aInterleaveImpl(uint16_t dest, uint16_t left, uint16_t right, uint16_t c) {
     int16_t *l = BUF_S16(left);
     int16_t *r = BUF_S16(right);
     int16_t *d = BUF_S16(dest);
+#if defined(MIXER_SSE2)
+    while (count > 0) {
+        __m128i lv = _mm_loadl_epi64((const __m128i*)l);
+        __m128i rv = _mm_loadl_epi64((const __m128i*)r);
+        _mm_storeu_si128((__m128i*)d, _mm_unpacklo_epi16(lv, rv));
+        l += 4;
+        r += 4;
+        d += 8;
+        --count;
+    }
+#elif defined(MIXER_NEON)
+    while (count > 0) {
+        int16x4x2_t lr = vzip_s16(vld1_s16(l), vld1_s16(r));
+        vst1q_s16(d, vcombine_s16(lr.val[0], lr.val[1]));
+        l += 4;
+        r += 4;
+        d += 8;
+        --count;
+    }
+#else
     while (count > 0) {
         int16_t l0 = *l++;
         int16_t l1 = *l++;
@@ -147,6 +244,7 @@ void aInterleaveImpl(uint16_t dest, uint16_t left, uint16_t right, uint16_t c) {
         *d++ = r3;
         --count;
     }
+#endif
 }
 
 void aDMEMMoveImpl(uint16_t in_addr, uint16_t out_addr, int nbytes) {
@@ -158,6 +256,80 @@ void aSetLoopImpl(ADPCM_STATE *adpcm_loop_state) {
     rspa.adpcm_loop_state = adpcm_loop_state;
 }
 
+// Predicts 8 samples from the two before out and 8 decoded residuals. Each output is a sum of products over
+// those 10 inputs, so the vector paths accumulate one input (or pair of inputs) across all 8 outputs at a time.
+// Sums wrap the same way the scalar int32 accumulator does, whatever order they're added in.
+static inline void adpcm_predict8(int16_t* out, int16_t (*tbl)[8], const int16_t* ins) {
+#if defined(MIXER_SSE2)
+    __m128i t0 = _mm_loadu_si128((const __m128i*)tbl[0]);
+    __m128i t1 = _mm_loadu_si128((const __m128i*)tbl[1]);
+    __m128i x = _mm_loadu_si128((const __m128i*)ins);
+    int32_t prevs;
+    memcpy(&prevs, out - 2, sizeof(prevs));
+    __m128i prev = _mm_set1_epi32(prevs);
+    __m128i lo = _mm_madd_epi16(prev, _mm_unpacklo_epi16(t0, t1));
+    __m128i hi = _mm_madd_epi16(prev, _mm_unpackhi_epi16(t0, t1));
+
+    // Column k weighs residual k: 2048 for its own output, then tbl[1] for the outputs after it
+#define ADPCM_COLUMN(k) _mm_insert_epi16(_mm_slli_si128(t1, 2 * ((k) + 1)), 2048, (k))
+#define ADPCM_ACCUMULATE_PAIR(k)                                                         \
+    do {                                                                                 \
+        __m128i pair = _mm_shuffle_epi32(x, _MM_SHUFFLE((k) / 2, (k) / 2, (k) / 2, (k) / 2)); \
+        __m128i c0 = ADPCM_COLUMN(k);                                                    \
+        __m128i c1 = ADPCM_COLUMN((k) + 1);                                              \
+        lo = _mm_add_epi32(lo, _mm_madd_epi16(pair, _mm_unpacklo_epi16(c0, c1)));        \
+        hi = _mm_add_epi32(hi, _mm_madd_epi16(pair, _mm_unpackhi_epi16(c0, c1)));        \
+    } while (0)
+    ADPCM_ACCUMULATE_PAIR(0);
+    ADPCM_ACCUMULATE_PAIR(2);
+    ADPCM_ACCUMULATE_PAIR(4);
+    ADPCM_ACCUMULATE_PAIR(6);
+#undef ADPCM_ACCUMULATE_PAIR
+#undef ADPCM_COLUMN
+
+    _mm_storeu_si128((__m128i*)out, _mm_packs_epi32(_mm_srai_epi32(lo, 11), _mm_srai_epi32(hi, 11)));
+#elif defined(MIXER_NEON)
+    int16x8_t t0 = vld1q_s16(tbl[0]);
+    int16x8_t t1 = vld1q_s16(tbl[1]);
+    int16x8_t zero = vdupq_n_s16(0);
+    int32x4_t lo = vmull_n_s16(vget_low_s16(t0), out[-2]);
+    int32x4_t hi = vmull_n_s16(vget_high_s16(t0), out[-2]);
+    lo = vmlal_n_s16(lo, vget_low_s16(t1), out[-1]);
+    hi = vmlal_n_s16(hi, vget_high_s16(t1), out[-1]);
+
+    // Column k weighs residual k: 2048 for its own output, then tbl[1] for the outputs after it
+#define ADPCM_ACCUMULATE(k)                                                        \
+    do {                                                                           \
+        int16x8_t c = vsetq_lane_s16(2048, vextq_s16(zero, t1, 7 - (k)), (k));     \
+        lo = vmlal_n_s16(lo, vget_low_s16(c), ins[k]);                             \
+        hi = vmlal_n_s16(hi, vget_high_s16(c), ins[k]);                            \
+    } while (0)
+    ADPCM_ACCUMULATE(0);
+    ADPCM_ACCUMULATE(1);
+    ADPCM_ACCUMULATE(2);
+    ADPCM_ACCUMULATE(3);
+    ADPCM_ACCUMULATE(4);
+    ADPCM_ACCUMULATE(5);
+    ADPCM_ACCUMULATE(6);
+    ADPCM_ACCUMULATE(7);
+#undef ADPCM_ACCUMULATE
+
+    vst1q_s16(out, vcombine_s16(vqmovn_s32(vshrq_n_s32(lo, 11)), vqmovn_s32(vshrq_n_s32(hi, 11))));
+#else
+    int16_t prev1 = out[-1];
+    int16_t prev2 = out[-2];
+    int j, k;
+    for (j = 0; j < 8; j++) {
+        int32_t acc = tbl[0][j] * prev2 + tbl[1][j] * prev1 + (ins[j] << 11);
+        for (k = 0; k < j; k++) {
+            acc += tbl[1][((j - k) - 1)] * ins[k];
+        }
+        acc >>= 11;
+        out[j] = clamp16(acc);
+    }
+#endif
+}
+
 void aADPCMdecImpl(uint8_t flags, ADPCM_STATE state) {
     uint8_t *in = BUF_U8(rspa.in);
     int16_t *out = BUF_S16(rspa.out);
@@ -179,9 +351,7 @@ void aADPCMdecImpl(uint8_t flags, ADPCM_STATE state) {
 
         for (i = 0; i < 2; i++) {
             int16_t ins[8];
-            int16_t prev1 = out[-1];
-            int16_t prev2 = out[-2];
-            int j, k;
+            int j;
 			if (flags & 4) {
 				for (j = 0; j < 2; j++) {
 					ins[j * 4] = (((*in >> 6) << 30) >> 30) << shift;
@@ -195,20 +365,63 @@ void aADPCMdecImpl(uint8_t flags, ADPCM_STATE state) {
 					ins[j * 2 + 1] = (((*in++ & 0xf) << 28) >> 28) << shift;
 				}
 			}
-            for (j = 0; j < 8; j++) {
-                int32_t acc = tbl[0][j] * prev2 + tbl[1][j] * prev1 + (ins[j] << 11);
-                for (k = 0; k < j; k++) {
-                    acc += tbl[1][((j - k) - 1)] * ins[k];
-                }
-                acc >>= 11;
-                *out++ = clamp16(acc);
-            }
+            adpcm_predict8(out, tbl, ins);
+            out += 8;
         }
         nbytes -= 16 * sizeof(int16_t);
     }
     memcpy(state, out - 16, 16 * sizeof(int16_t));
 }
 
+// Filters 8 output samples, each from 4 input samples starting at in[i] through the table row tbl[i]. Every
+// tap is rounded on its own before the 4 are summed, as the scalar loop does.
+static inline void resample_filter8(int16_t* out, int16_t* const* in, int16_t* const* tbl) {
+#if defined(MIXER_SSE2)
+    const __m128i rounding = _mm_set1_epi32(0x4000);
+    __m128i taps[8];
+    int i;
+
+    for (i = 0; i < 8; i += 2) {
+        __m128i s = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*)in[i]), _mm_loadl_epi64((const __m128i*)in[i + 1]));
+        __m128i t = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*)tbl[i]), _mm_loadl_epi64((const __m128i*)tbl[i + 1]));
+        __m128i lo = _mm_mullo_epi16(s, t);
+        __m128i hi = _mm_mulhi_epi16(s, t);
+        taps[i] = _mm_srai_epi32(_mm_add_epi32(_mm_unpacklo_epi16(lo, hi), rounding), 15);
+        taps[i + 1] = _mm_srai_epi32(_mm_add_epi32(_mm_unpackhi_epi16(lo, hi), rounding), 15);
+    }
+
+    // Transpose each group of 4 so the taps of one sample end up summed into one lane
+    __m128i sums[2];
+    for (i = 0; i < 2; i++) {
+        __m128i* t = taps + i * 4;
+        __m128i a = _mm_add_epi32(_mm_unpacklo_epi32(t[0], t[1]), _mm_unpackhi_epi32(t[0], t[1]));
+        __m128i b = _mm_add_epi32(_mm_unpacklo_epi32(t[2], t[3]), _mm_unpackhi_epi32(t[2], t[3]));
+        sums[i] = _mm_add_epi32(_mm_unpacklo_epi64(a, b), _mm_unpackhi_epi64(a, b));
+    }
+    _mm_storeu_si128((__m128i*)out, _mm_packs_epi32(sums[0], sums[1]));
+#elif defined(MIXER_NEON)
+    const int32x4_t rounding = vdupq_n_s32(0x4000);
+    int32x4_t taps[8];
+    int i;
+
+    for (i = 0; i < 8; i++) {
+        taps[i] = vshrq_n_s32(vaddq_s32(vmull_s16(vld1_s16(in[i]), vld1_s16(tbl[i])), rounding), 15);
+    }
+    int32x4_t lo = vpaddq_s32(vpaddq_s32(taps[0], taps[1]), vpaddq_s32(taps[2], taps[3]));
+    int32x4_t hi = vpaddq_s32(vpaddq_s32(taps[4], taps[5]), vpaddq_s32(taps[6], taps[7]));
+    vst1q_s16(out, vcombine_s16(vqmovn_s32(lo), vqmovn_s32(hi)));
+#else
+    int i;
+    for (i = 0; i < 8; i++) {
+        int32_t sample = ((in[i][0] * tbl[i][0] + 0x4000) >> 15) +
+                         ((in[i][1] * tbl[i][1] + 0x4000) >> 15) +
+                         ((in[i][2] * tbl[i][2] + 0x4000) >> 15) +
+                         ((in[i][3] * tbl[i][3] + 0x4000) >> 15);
+        out[i] = clamp16(sample);
+    }
+#endif
+}
+
 void aResampleImpl(uint8_t flags, uint16_t pitch, RESAMPLE_STATE state) {
     int16_t tmp[16];
     int16_t *in_initial = BUF_S16(rspa.in);
@@ -217,8 +430,8 @@ void aResampleImpl(uint8_t flags, uint16_t pitch, RESAMPLE_STATE state) {
     int nbytes = ROUND_UP_16(rspa.nbytes);
     uint32_t pitch_accumulator;
     int i;
-    int16_t *tbl;
-    int32_t sample;
+    int16_t *block_in[8];
+    int16_t *block_tbl[8];
 
     if (flags & A_INIT) {
         memset(tmp, 0, 5 * sizeof(int16_t));
@@ -235,17 +448,15 @@ void aResampleImpl(uint8_t flags, uint16_t pitch, RESAMPLE_STATE state) {
 
     do {
         for (i = 0; i < 8; i++) {
-            tbl = resample_table[pitch_accumulator * 64 >> 16];
-            sample = ((in[0] * tbl[0] + 0x4000) >> 15) +
-                     ((in[1] * tbl[1] + 0x4000) >> 15) +
-                     ((in[2] * tbl[2] + 0x4000) >> 15) +
-                     ((in[3] * tbl[3] + 0x4000) >> 15);
-            *out++ = clamp16(sample);
+            block_in[i] = in;
+            block_tbl[i] = resample_table[pitch_accumulator * 64 >> 16];
 
             pitch_accumulator += (pitch << 1);
             in += pitch_accumulator >> 16;
             pitch_accumulator %= 0x10000;
         }
+        resample_filter8(out, block_in, block_tbl);
+        out += 8;
         nbytes -= 8 * sizeof(int16_t);
     } while (nbytes > 0);
 
@@ -289,6 +500,49 @@ void aEnvMixerImpl(uint16_t in_addr, uint16_t n_samples, bool swap_reverb,
     uint16_t vol_wet = rspa.vol_wet;
     uint16_t rate_wet = rspa.rate_wet;
 
+#if defined(MIXER_SSE2)
+    do {
+        __m128i in_samples = _mm_loadu_si128((const __m128i*)in);
+        __m128i samples[2];
+        in += 8;
+        for (int j = 0; j < 2; j++) {
+            samples[j] = _mm_xor_si128(mulhi_vol(in_samples, vols[j]), _mm_set1_epi16(negs[j]));
+        }
+        for (int j = 0; j < 2; j++) {
+            __m128i wet_samples = _mm_xor_si128(mulhi_vol(samples[swapped[j]], vol_wet), _mm_set1_epi16(negs[2 + j]));
+            _mm_storeu_si128((__m128i*)dry[j], _mm_adds_epi16(_mm_loadu_si128((const __m128i*)dry[j]), samples[j]));
+            dry[j] += 8;
+            _mm_storeu_si128((__m128i*)wet[j], _mm_adds_epi16(_mm_loadu_si128((const __m128i*)wet[j]), wet_samples));
+            wet[j] += 8;
+        }
+        vols[0] += rates[0];
+        vols[1] += rates[1];
+        vol_wet += rate_wet;
+
+        n -= 8;
+    } while (n > 0);
+#elif defined(MIXER_NEON)
+    do {
+        int16x8_t in_samples = vld1q_s16(in);
+        int16x8_t samples[2];
+        in += 8;
+        for (int j = 0; j < 2; j++) {
+            samples[j] = veorq_s16(mulhi_vol(in_samples, vols[j]), vdupq_n_s16(negs[j]));
+        }
+        for (int j = 0; j < 2; j++) {
+            int16x8_t wet_samples = veorq_s16(mulhi_vol(samples[swapped[j]], vol_wet), vdupq_n_s16(negs[2 + j]));
+            vst1q_s16(dry[j], vqaddq_s16(vld1q_s16(dry[j]), samples[j]));
+            dry[j] += 8;
+            vst1q_s16(wet[j], vqaddq_s16(vld1q_s16(wet[j]), wet_samples));
+            wet[j] += 8;
+        }
+        vols[0] += rates[0];
+        vols[1] += rates[1];
+        vol_wet += rate_wet;
+
+        n -= 8;
+    } while (n > 0);
+#else
     do {
         for (int i = 0; i < 8; i++) {
             int16_t samples[2] = {*in, *in}; in++;
@@ -306,15 +560,84 @@ void aEnvMixerImpl(uint16_t in_addr, uint16_t n_samples, bool swap_reverb,
 
         n -= 8;
     } while (n > 0);
+#endif
+}
+
+#if defined(MIXER_AVX2)
+MIXER_AVX2_TARGET static void mix_avx2(int nbytes, int16_t gain, const int16_t* in, int16_t* out) {
+    if (gain == -0x8000) {
+        for (; nbytes > 0; nbytes -= 16 * sizeof(int16_t), in += 16, out += 16) {
+            __m256i o = _mm256_loadu_si256((const __m256i*)out);
+            _mm256_storeu_si256((__m256i*)out, _mm256_subs_epi16(o, _mm256_loadu_si256((const __m256i*)in)));
+        }
+        return;
+    }
+
+    // Unpack and pack both work within each 128 bit lane, so the samples come back out in order
+    const __m256i weights = _mm256_set1_epi32((int32_t)(0x7fff | ((uint32_t)(uint16_t)gain << 16)));
+    const __m256i rounding = _mm256_set1_epi32(0x4000);
+    for (; nbytes > 0; nbytes -= 16 * sizeof(int16_t), in += 16, out += 16) {
+        __m256i o = _mm256_loadu_si256((const __m256i*)out);
+        __m256i n = _mm256_loadu_si256((const __m256i*)in);
+        __m256i lo = _mm256_add_epi32(_mm256_madd_epi16(_mm256_unpacklo_epi16(o, n), weights), rounding);
+        __m256i hi = _mm256_add_epi32(_mm256_madd_epi16(_mm256_unpackhi_epi16(o, n), weights), rounding);
+        _mm256_storeu_si256((__m256i*)out, _mm256_packs_epi32(_mm256_srai_epi32(lo, 15), _mm256_srai_epi32(hi, 15)));
+    }
 }
+#endif
 
 void aMixImpl(uint16_t count, int16_t gain, uint16_t in_addr, uint16_t out_addr) {
     int nbytes = ROUND_UP_32(ROUND_DOWN_16(count << 4));
     int16_t *in = BUF_S16(in_addr);
     int16_t *out = BUF_S16(out_addr);
+#if !defined(MIXER_SSE2) && !defined(MIXER_NEON)
     int i;
     int32_t sample;
+#endif
 
+#if defined(MIXER_AVX2)
+    if (mixer_use_avx2() && mixer_avx2_no_overlap(in, out)) {
+        mix_avx2(nbytes, gain, in, out);
+        return;
+    }
+#endif
+
+#if defined(MIXER_SSE2)
+    if (gain == -0x8000) {
+        for (; nbytes > 0; nbytes -= 8 * sizeof(int16_t), in += 8, out += 8) {
+            __m128i o = _mm_loadu_si128((const __m128i*)out);
+            _mm_storeu_si128((__m128i*)out, _mm_subs_epi16(o, _mm_loadu_si128((const __m128i*)in)));
+        }
+    }
+
+    // Each output is out * 0x7fff + in * gain, one madd over interleaved out/in pairs
+    const __m128i weights = _mm_set1_epi32((int32_t)(0x7fff | ((uint32_t)(uint16_t)gain << 16)));
+    const __m128i rounding = _mm_set1_epi32(0x4000);
+    for (; nbytes > 0; nbytes -= 8 * sizeof(int16_t), in += 8, out += 8) {
+        __m128i o = _mm_loadu_si128((const __m128i*)out);
+        __m128i n = _mm_loadu_si128((const __m128i*)in);
+        __m128i lo = _mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(o, n), weights), rounding);
+        __m128i hi = _mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(o, n), weights), rounding);
+        _mm_storeu_si128((__m128i*)out, _mm_packs_epi32(_mm_srai_epi32(lo, 15), _mm_srai_epi32(hi, 15)));
+    }
+#elif defined(MIXER_NEON)
+    if (gain == -0x8000) {
+        for (; nbytes > 0; nbytes -= 8 * sizeof(int16_t), in += 8, out += 8) {
+            vst1q_s16(out, vqsubq_s16(vld1q_s16(out), vld1q_s16(in)));
+        }
+    }
+
+    const int32x4_t rounding = vdupq_n_s32(0x4000);
+    for (; nbytes > 0; nbytes -= 8 * sizeof(int16_t), in += 8, out += 8) {
+        int16x8_t o = vld1q_s16(out);
+        int16x8_t n = vld1q_s16(in);
+        int32x4_t lo = vmlal_n_s16(vmull_n_s16(vget_low_s16(o), 0x7fff), vget_low_s16(n), gain);
+        int32x4_t hi = vmlal_n_s16(vmull_n_s16(vget_high_s16(o), 0x7fff), vget_high_s16(n), gain);
+        lo = vshrq_n_s32(vaddq_s32(lo, rounding), 15);
+        hi = vshrq_n_s32(vaddq_s32(hi, rounding), 15);
+        vst1q_s16(out, vcombine_s16(vqmovn_s32(lo), vqmovn_s32(hi)));
+    }
+#else
     if (gain == -0x8000) {
         while (nbytes > 0) {
             for (i = 0; i < 16; i++) {
@@ -333,6 +656,7 @@ void aMixImpl(uint16_t count, int16_t gain, uint16_t in_addr, uint16_t out_addr)
 
         nbytes -= 16 * sizeof(int16_t);
     }
+#endif
 }
 
 void aS8DecImpl(uint8_t flags, ADPCM_STATE state) {
@@ -372,11 +696,52 @@ void aS8DecImpl(uint8_t flags, ADPCM_STATE state) {
     memcpy(state, out - 16, 16 * sizeof(int16_t));
 }
 
+#if defined(MIXER_AVX2)
+MIXER_AVX2_TARGET static void add_mixer_avx2(int nbytes, const int16_t* in, int16_t* out) {
+    do {
+        __m256i o = _mm256_loadu_si256((const __m256i*)out);
+        _mm256_storeu_si256((__m256i*)out, _mm256_adds_epi16(o, _mm256_loadu_si256((const __m256i*)in)));
+        in += 16;
+        out += 16;
+
+        nbytes -= 16 * sizeof(int16_t);
+    } while (nbytes > 0);
+}
+#endif
+
 void aAddMixerImpl(uint16_t count, uint16_t in_addr, uint16_t out_addr) {
     int16_t *in = BUF_S16(in_addr);
     int16_t *out = BUF_S16(out_addr);
     int nbytes = ROUND_UP_64(ROUND_DOWN_16(count));
 
+#if defined(MIXER_AVX2)
+    if (mixer_use_avx2() && mixer_avx2_no_overlap(in, out)) {
+        add_mixer_avx2(nbytes, in, out);
+        return;
+    }
+#endif
+
+#if defined(MIXER_SSE2)
+    do {
+        for (int i = 0; i < 16; i += 8) {
+            __m128i o = _mm_loadu_si128((const __m128i*)(out + i));
+            _mm_storeu_si128((__m128i*)(out + i), _mm_adds_epi16(o, _mm_loadu_si128((const __m128i*)(in + i))));
+        }
+        in += 16;
+        out += 16;
+
+        nbytes -= 16 * sizeof(int16_t);
+    } while (nbytes > 0);
+#elif defined(MIXER_NEON)
+    do {
+        vst1q_s16(out, vqaddq_s16(vld1q_s16(out), vld1q_s16(in)));
+        vst1q_s16(out + 8, vqaddq_s16(vld1q_s16(out + 8), vld1q_s16(in + 8)));
+        in += 16;
+        out += 16;
+
+        nbytes -= 16 * sizeof(int16_t);
+    } while (nbytes > 0);
+#else
     do {
         *out = clamp16(*out + *in++); out++;
         *out = clamp16(*out + *in++); out++;
@@ -397,6 +762,7 @@ void aAddMixerImpl(uint16_t count, uint16_t in_addr, uint16_t out_addr) {
 
         nbytes -= 16 * sizeof(int16_t);
     } while (nbytes > 0);
+#endif
 }
 
 void aDuplicateImpl(uint16_t count, uint16_t in_addr, uint16_t out_addr) {
@@ -447,6 +813,46 @@ void aInterlImpl(uint16_t in_addr, uint16_t out_addr, uint16_t n_samples) {
     } while (n > 0);
 }
 
+// Runs the 8 tap filter over the 8 new samples in tmp[8..15], with tmp[0..7] holding the 8 before them.
+// The vector paths sum in 32 bits, which only matches the scalar 64 bit sum while it can't overflow.
+static inline void filter8(int16_t* out, const int16_t* tmp, bool sum_fits_32) {
+#if defined(MIXER_SSE2)
+    if (sum_fits_32) {
+        __m128i lo = _mm_set1_epi32(0x4000);
+        __m128i hi = lo;
+        for (int j = 0; j < 8; j++) {
+            __m128i x = _mm_loadu_si128((const __m128i*)(tmp + j));
+            __m128i c = _mm_set1_epi16(rspa.filter[7 - j]);
+            __m128i plo = _mm_mullo_epi16(x, c);
+            __m128i phi = _mm_mulhi_epi16(x, c);
+            lo = _mm_add_epi32(lo, _mm_unpacklo_epi16(plo, phi));
+            hi = _mm_add_epi32(hi, _mm_unpackhi_epi16(plo, phi));
+        }
+        _mm_storeu_si128((__m128i*)out, _mm_packs_epi32(_mm_srai_epi32(lo, 15), _mm_srai_epi32(hi, 15)));
+        return;
+    }
+#elif defined(MIXER_NEON)
+    if (sum_fits_32) {
+        int32x4_t lo = vdupq_n_s32(0x4000);
+        int32x4_t hi = lo;
+        for (int j = 0; j < 8; j++) {
+            int16x8_t x = vld1q_s16(tmp + j);
+            lo = vmlal_n_s16(lo, vget_low_s16(x), rspa.filter[7 - j]);
+            hi = vmlal_n_s16(hi, vget_high_s16(x), rspa.filter[7 - j]);
+        }
+        vst1q_s16(out, vcombine_s16(vqmovn_s32(vshrq_n_s32(lo, 15)), vqmovn_s32(vshrq_n_s32(hi, 15))));
+        return;
+    }
+#endif
+    for (int i = 0; i < 8; i++) {
+        int64_t sample = 0x4000; // round term
+        for (int j = 0; j < 8; j++) {
+            sample += tmp[i + j] * rspa.filter[7 - j];
+        }
+        out[i] = clamp16((int32_t)(sample >> 15));
+    }
+}
+
 void aFilterImpl(uint8_t flags, uint16_t count_or_buf, int16_t *state_or_filter) {
     if (flags > A_INIT) {
         rspa.filter_count = ROUND_UP_16(count_or_buf);
@@ -471,19 +877,17 @@ void aFilterImpl(uint8_t flags, uint16_t count_or_buf, int16_t *state_or_filter)
             memcpy(tmp2, state_or_filter + 8, 8 * sizeof(int16_t));
         }
 
+        // With the taps' magnitudes summing to under 0x10000, no run of samples can push the sum past 32 bits
+        int32_t filter_magnitude = 0;
         for (int i = 0; i < 8; i++) {
             rspa.filter[i] = (tmp2[i] + rspa.filter[i]) / 2;
+            filter_magnitude += rspa.filter[i] < 0 ? -rspa.filter[i] : rspa.filter[i];
         }
+        bool sum_fits_32 = filter_magnitude < 0x10000;
 
         do {
             memcpy(tmp + 8, buf, 8 * sizeof(int16_t));
-            for (int i = 0; i < 8; i++) {
-                int64_t sample = 0x4000; // round term
-                for (int j = 0; j < 8; j++) {
-                    sample += tmp[i + j] * rspa.filter[7 - j];
-                }
-                buf[i] = clamp16((int32_t)(sample >> 15));
-            }
+            filter8(buf, tmp, sum_fits_32);
             memcpy(tmp, tmp + 8, 8 * sizeof(int16_t));
 
             buf += 8;
@@ -499,6 +903,30 @@ void aHiLoGainImpl(uint8_t g, uint16_t count, uint16_t addr) {
     int16_t *samples = BUF_S16(addr);
     int nbytes = ROUND_UP_32(count);
 
+#if defined(MIXER_SSE2)
+    const __m128i gain = _mm_set1_epi16(g);
+    do {
+        __m128i x = _mm_loadu_si128((const __m128i*)samples);
+        __m128i lo = _mm_mullo_epi16(x, gain);
+        __m128i hi = _mm_mulhi_epi16(x, gain);
+        __m128i plo = _mm_srai_epi32(_mm_unpacklo_epi16(lo, hi), 4);
+        __m128i phi = _mm_srai_epi32(_mm_unpackhi_epi16(lo, hi), 4);
+        _mm_storeu_si128((__m128i*)samples, _mm_packs_epi32(plo, phi));
+        samples += 8;
+
+        nbytes -= 8;
+    } while (nbytes > 0);
+#elif defined(MIXER_NEON)
+    do {
+        int16x8_t x = vld1q_s16(samples);
+        int32x4_t lo = vshrq_n_s32(vmull_n_s16(vget_low_s16(x), g), 4);
+        int32x4_t hi = vshrq_n_s32(vmull_n_s16(vget_high_s16(x), g), 4);
+        vst1q_s16(samples, vcombine_s16(vqmovn_s32(lo), vqmovn_s32(hi)));
+        samples += 8;
+
+        nbytes -= 8;
+    } while (nbytes > 0);
+#else
     do {
         *samples = clamp16((*samples * g) >> 4); samples++;
         *samples = clamp16((*samples * g) >> 4); samples++;
@@ -511,6 +939,7 @@ void aHiLoGainImpl(uint8_t g, uint16_t count, uint16_t addr) {
 
         nbytes -= 8;
     } while (nbytes > 0);
+#endif
 }
 
 void aUnkCmd3Impl(uint16_t a, uint16_t b, uint16_t c) {
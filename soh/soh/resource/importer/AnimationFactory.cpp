@@ -1,5 +1,6 @@
 #include "soh/resource/importer/AnimationFactory.h"
 #include "soh/resource/type/Animation.h"
+#include "soh/resource/importer/BinaryReaderHelpers.h"
 #include "spdlog/spdlog.h"
 
 namespace SOH {
@@ -20,21 +21,13 @@ std::shared_ptr<Ship::IResource> ResourceFactoryBinaryAnimationV0::ReadResource(
 
         // Populate frame data
         uint32_t rotValuesCnt = reader->ReadUInt32();
-        animation->rotationValues.reserve(rotValuesCnt);
-        for (uint32_t i = 0; i < rotValuesCnt; i++) {
-            animation->rotationValues.push_back(reader->ReadUInt16());
-        }
+        ReadArray(reader, animation->rotationValues, rotValuesCnt);
         animation->animationData.animationHeader.frameData = (int16_t*)animation->rotationValues.data();
 
         // Populate joint indices
         uint32_t rotIndCnt = reader->ReadUInt32();
-        animation->rotationIndices.reserve(rotIndCnt);
-        for (size_t i = 0; i < rotIndCnt; i++) {
-            uint16_t x = reader->ReadUInt16();
-            uint16_t y = reader->ReadUInt16();
-            uint16_t z = reader->ReadUInt16();
-            animation->rotationIndices.push_back(RotationIndex(x, y, z));
-        }
+        animation->rotationIndices.resize(rotIndCnt);
+        ReadArray(reader, (uint16_t*)animation->rotationIndices.data(), rotIndCnt * 3);
         animation->animationData.animationHeader.jointIndices = (JointIndex*)animation->rotationIndices.data();
 
         // Set static index max
@@ -45,10 +38,7 @@ std::shared_ptr<Ship::IResource> ResourceFactoryBinaryAnimationV0::ReadResource(
 
         // Set refIndex
         uint32_t refArrCnt = reader->ReadUInt32();
-        animation->refIndexArr.reserve(refArrCnt);
-        for (uint32_t i = 0; i < refArrCnt; i++) {
-            animation->refIndexArr.push_back(reader->ReadUByte());
-        }
+        ReadArray(reader, animation->refIndexArr, refArrCnt);
         animation->animationData.transformUpdateIndex.refIndex = animation->refIndexArr.data();
 
         // Populate transform data
@@ -68,10 +58,7 @@ std::shared_ptr<Ship::IResource> ResourceFactoryBinaryAnimationV0::ReadResource(
 
         // Populate copy values
         uint32_t copyValuesCnt = reader->ReadUInt32();
-        animation->copyValuesArr.reserve(copyValuesCnt);
-        for (uint32_t i = 0; i < copyValuesCnt; i++) {
-            animation->copyValuesArr.push_back(reader->ReadInt16());
-        }
+        ReadArray(reader, animation->copyValuesArr, copyValuesCnt);
         animation->animationData.transformUpdateIndex.copyValues = animation->copyValuesArr.data();
     } else if (animType == AnimationType::Link) {
         // Read the frame count
@@ -1,5 +1,6 @@
 #include "soh/resource/importer/AudioSampleFactory.h"
 #include "soh/resource/type/AudioSample.h"
+#include "soh/resource/importer/BinaryReaderHelpers.h"
 #include "spdlog/spdlog.h"
 
 namespace SOH {
@@ -17,10 +18,7 @@ std::shared_ptr<Ship::IResource> ResourceFactoryBinaryAudioSampleV2::ReadResourc
     audioSample->sample.unk_bit25 = reader->ReadUByte();
     audioSample->sample.size = reader->ReadUInt32();
 
-    audioSample->audioSampleData.reserve(audioSample->sample.size);
-    for (uint32_t i = 0; i < audioSample->sample.size; i++) {
-        audioSample->audioSampleData.push_back(reader->ReadUByte());
-    }
+    ReadArray(reader, audioSample->audioSampleData, audioSample->sample.size);
     audioSample->sample.sampleAddr = audioSample->audioSampleData.data();
 
     audioSample->loop.start = reader->ReadUInt32();
@@ -31,19 +29,14 @@ std::shared_ptr<Ship::IResource> ResourceFactoryBinaryAudioSampleV2::ReadResourc
     for (int i = 0; i < 16; i++) {
         audioSample->loop.state[i] = 0;
     }
-    for (uint32_t i = 0; i < audioSample->loopStateCount; i++) {
-        audioSample->loop.state[i] = reader->ReadInt16();
-    }
+    ReadArray(reader, audioSample->loop.state, audioSample->loopStateCount);
     audioSample->sample.loop = &audioSample->loop;
 
     audioSample->book.order = reader->ReadInt32();
     audioSample->book.npredictors = reader->ReadInt32();
     audioSample->bookDataCount = reader->ReadUInt32();
 
-    audioSample->bookData.reserve(audioSample->bookDataCount);
-    for (uint32_t i = 0; i < audioSample->bookDataCount; i++) {
-        audioSample->bookData.push_back(reader->ReadInt16());
-    }
+    ReadArray(reader, audioSample->bookData, audioSample->bookDataCount);
     audioSample->book.book = audioSample->bookData.data();
     audioSample->sample.book = &audioSample->book;
 
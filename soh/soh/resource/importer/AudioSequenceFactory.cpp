@@ -1,5 +1,6 @@
 #include "soh/resource/importer/AudioSequenceFactory.h"
 #include "soh/resource/type/AudioSequence.h"
+#include "soh/resource/importer/BinaryReaderHelpers.h"
 #include "spdlog/spdlog.h"
 
 namespace SOH {
@@ -12,10 +13,7 @@ std::shared_ptr<Ship::IResource> ResourceFactoryBinaryAudioSequenceV2::ReadResou
     auto reader = std::get<std::shared_ptr<Ship::BinaryReader>>(file->Reader);
 
     audioSequence->sequence.seqDataSize = reader->ReadInt32();
-    audioSequence->sequenceData.reserve(audioSequence->sequence.seqDataSize);
-    for (uint32_t i = 0; i < audioSequence->sequence.seqDataSize; i++) {
-        audioSequence->sequenceData.push_back(reader->ReadChar());
-    }
+    ReadArray(reader, audioSequence->sequenceData, audioSequence->sequence.seqDataSize);
     audioSequence->sequence.seqData = audioSequence->sequenceData.data();
     
     audioSequence->sequence.seqNumber = reader->ReadUByte();
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "ResourceFactoryBinary.h"
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace SOH {
+// Reads count values in one copy instead of one Read* call each. Values are swapped in place afterwards when the
+// file wasn't written in the host's byte order; the loops are plain shifts so compilers vectorize them.
+template <typename T> void ReadArray(const std::shared_ptr<Ship::BinaryReader>& reader, T* dest, uint32_t count) {
+    static_assert(std::is_integral_v<T> && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4),
+                  "ReadArray only supports 8, 16 and 32 bit integers");
+
+    if (count == 0) {
+        return;
+    }
+    reader->Read((char*)dest, (int32_t)(count * sizeof(T)));
+
+    if constexpr (sizeof(T) > 1) {
+        if (reader->GetEndianness() == Ship::Endianness::Native) {
+            return;
+        }
+
+        using U = std::make_unsigned_t<T>;
+        U* values = (U*)dest;
+        for (uint32_t i = 0; i < count; i++) {
+            U v = values[i];
+            if constexpr (sizeof(T) == 2) {
+                values[i] = (U)((v >> 8) | (v << 8));
+            } else {
+                values[i] = (v >> 24) | ((v >> 8) & 0xFF00) | ((v << 8) & 0xFF0000) | (v << 24);
+            }
+        }
+    }
+}
+
+template <typename T>
+void ReadArray(const std::shared_ptr<Ship::BinaryReader>& reader, std::vector<T>& dest, uint32_t count) {
+    dest.resize(count);
+    ReadArray(reader, dest.data(), count);
+}
+} // namespace SOH
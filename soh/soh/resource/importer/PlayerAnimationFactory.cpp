@@ -1,5 +1,6 @@
 #include "soh/resource/importer/PlayerAnimationFactory.h"
 #include "soh/resource/type/PlayerAnimation.h"
+#include "soh/resource/importer/BinaryReaderHelpers.h"
 #include "spdlog/spdlog.h"
 
 namespace SOH {
@@ -12,11 +13,7 @@ std::shared_ptr<Ship::IResource> ResourceFactoryBinaryPlayerAnimationV0::ReadRes
     auto reader = std::get<std::shared_ptr<Ship::BinaryReader>>(file->Reader);
 
     uint32_t numEntries = reader->ReadUInt32();
-    playerAnimation->limbRotData.reserve(numEntries);
-
-    for (uint32_t i = 0; i < numEntries; i++) {
-        playerAnimation->limbRotData.push_back(reader->ReadInt16());
-    }
+    ReadArray(reader, playerAnimation->limbRotData, numEntries);
 
     return playerAnimation;
 };
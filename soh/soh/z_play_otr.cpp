@@ -16,10 +16,27 @@ s32 OTRScene_ExecuteCommands(PlayState* play, SOH::Scene* scene);
 //LUS::OTRResource* OTRPlay_LoadFile(PlayState* play, RomFile* file) {
 Ship::IResource* OTRPlay_LoadFile(PlayState* play, const char* fileName)
 {
-    auto res = Ship::Context::GetInstance()->GetResourceManager()->LoadResource(fileName);
+    auto res = ResourceMgr_TakePrefetchedResource(fileName);
+    if (res == nullptr) {
+        res = Ship::Context::GetInstance()->GetResourceManager()->LoadResource(fileName);
+    }
     return res.get();
 }
 
+std::string OTRPlay_GetScenePath(s32 sceneId) {
+    SceneTableEntry* scene = &gSceneTable[sceneId];
+
+    // Scenes considered "dungeon" with a MQ variant
+    int16_t inNonSharedScene = (sceneId >= SCENE_DEKU_TREE && sceneId <= SCENE_ICE_CAVERN) ||
+                               sceneId == SCENE_GERUDO_TRAINING_GROUND || sceneId == SCENE_INSIDE_GANONS_CASTLE;
+
+    std::string sceneVersion = "shared";
+    if (inNonSharedScene) {
+        sceneVersion = ResourceMgr_IsSceneMasterQuest(sceneId) ? "mq" : "nonmq";
+    }
+    return StringHelper::Sprintf("scenes/%s/%s/%s", sceneVersion.c_str(), scene->sceneFile.fileName, scene->sceneFile.fileName);
+}
+
 extern "C" void OTRPlay_SpawnScene(PlayState* play, s32 sceneId, s32 spawn) {
     SceneTableEntry* scene = &gSceneTable[sceneId];
 
@@ -30,15 +47,7 @@ extern "C" void OTRPlay_SpawnScene(PlayState* play, s32 sceneId, s32 spawn) {
 
     //osSyncPrintf("\nSCENE SIZE %fK\n", (scene->sceneFile.vromEnd - scene->sceneFile.vromStart) / 1024.0f);
 
-    // Scenes considered "dungeon" with a MQ variant
-    int16_t inNonSharedScene = (sceneId >= SCENE_DEKU_TREE && sceneId <= SCENE_ICE_CAVERN) ||
-                               sceneId == SCENE_GERUDO_TRAINING_GROUND || sceneId == SCENE_INSIDE_GANONS_CASTLE;
-
-    std::string sceneVersion = "shared";
-    if (inNonSharedScene) {
-        sceneVersion = ResourceMgr_IsGameMasterQuest() ? "mq" : "nonmq";
-    }
-    std::string scenePath = StringHelper::Sprintf("scenes/%s/%s/%s", sceneVersion.c_str(), scene->sceneFile.fileName, scene->sceneFile.fileName);
+    std::string scenePath = OTRPlay_GetScenePath(sceneId);
 
     play->sceneSegment = OTRPlay_LoadFile(play, scenePath.c_str());
 
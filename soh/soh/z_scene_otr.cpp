@@ -34,8 +34,10 @@
 #include "soh/resource/type/scenecommand/SetSoundSettings.h"
 #include "soh/resource/type/scenecommand/SetEchoSettings.h"
 #include "soh/resource/type/scenecommand/SetAlternateHeaders.h"
+#include "soh/resource/type/scenecommand/SetExitList.h"
 
 extern Ship::IResource* OTRPlay_LoadFile(PlayState* play, const char* fileName);
+extern std::string OTRPlay_GetScenePath(s32 sceneId);
 extern "C" s32 Object_Spawn(ObjectContext* objectCtx, s16 objectId);
 extern "C" RomFile sNaviMsgFiles[];
 s32 OTRScene_ExecuteCommands(PlayState* play, SOH::Scene* scene);
@@ -301,8 +303,18 @@ bool Scene_CommandWindSettings(PlayState* play, SOH::ISceneCommand* cmd) {
 }
 
 bool Scene_CommandExitList(PlayState* play, SOH::ISceneCommand* cmd) {
+    SOH::SetExitList* cmdExits = (SOH::SetExitList*)cmd;
     play->setupExitList = (s16*)cmd->GetRawPointer();
 
+    // Start loading the scenes this one leads to, so taking an exit doesn't have to wait on the scene file
+    for (uint32_t i = 0; i < cmdExits->numExits; i++) {
+        uint16_t entrance = cmdExits->exits[i];
+        if (entrance >= ENTR_MAX || gEntranceTable[entrance].scene == play->sceneNum) {
+            continue;
+        }
+        ResourceMgr_PrefetchResource(OTRPlay_GetScenePath(gEntranceTable[entrance].scene));
+    }
+
     return false;
 }
 
@@ -516,6 +528,18 @@ extern "C" s32 OTRfunc_8009728C(PlayState* play, RoomContext* roomCtx, s32 roomN
 
         roomCtx->unk_30 ^= 1;
 
+        // Start loading the rooms on the other side of this room's doors and loading planes
+        for (s32 i = 0; i < play->transiActorCtx.numActors; i++) {
+            TransitionActorEntry* transitionActor = &play->transiActorCtx.list[i];
+            for (s32 side = 0; side < 2; side++) {
+                s8 nextRoom = transitionActor->sides[side ^ 1].room;
+                if (transitionActor->sides[side].room == roomNum && nextRoom >= 0 && nextRoom < play->numRooms &&
+                    nextRoom != roomNum) {
+                    ResourceMgr_PrefetchResourceByNameHandlingMQ(play->roomList[nextRoom].fileName);
+                }
+            }
+        }
+
         SPDLOG_INFO("Room Init - curRoom.num: {0:#x}", roomCtx->curRoom.num);
 
         return 1;
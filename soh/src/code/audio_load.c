@@ -1346,6 +1346,7 @@ void AudioLoad_Init(void* heap, size_t heapSize) {
 
     AudioHeap_ResetStep();
 
+    OSTime bankLoadStart = osGetTime();
     int seqListSize = 0;
     int customSeqListSize = 0;
     char** seqList = ResourceMgr_ListFiles("audio/sequences*", &seqListSize);
@@ -1356,7 +1357,7 @@ void AudioLoad_Init(void* heap, size_t heapSize) {
 
     for (size_t i = 0; i < seqListSize; i++)
     {
-        SequenceData sDat = ResourceMgr_LoadSeqByName(seqList[i]);
+        SequenceData sDat = ResourceMgr_LoadSeqHeaderByName(seqList[i]);
 
         char* str = malloc(strlen(seqList[i]) + 1);
         strcpy(str, seqList[i]);
@@ -1383,7 +1384,7 @@ void AudioLoad_Init(void* heap, size_t heapSize) {
         }
         int j = i - startingSeqNum;
         AudioCollection_AddToCollection(customSeqList[j], seqNum);
-        SequenceData sDat = ResourceMgr_LoadSeqByName(customSeqList[j]);
+        SequenceData sDat = ResourceMgr_LoadSeqHeaderByName(customSeqList[j]);
         sDat.seqNumber = seqNum;
 
         char* str = malloc(strlen(customSeqList[j]) + 1);
@@ -1395,19 +1396,26 @@ void AudioLoad_Init(void* heap, size_t heapSize) {
 
     free(customSeqList);
 
+    // Custom sequences can be chosen as replacements, so the table can only be built once they're all added
+    AudioCollection_UpdateReplacementTable();
+
     int fntListSize = 0;
     char** fntList = ResourceMgr_ListFiles("audio/fonts*", &fntListSize);
 
+    // Only the font indices are needed here. The fonts themselves, along with all of their samples, are loaded in
+    // the background, and AudioLoad_SyncLoadFont and friends wait for whichever one they need first
     for (int i = 0; i < fntListSize; i++)
     {
-        SoundFont* sf = ResourceMgr_LoadAudioSoundFont(fntList[i]);
-
         char* str = malloc(strlen(fntList[i]) + 1);
         strcpy(str, fntList[i]);
 
-        fontMap[sf->fntIndex] = str;
+        fontMap[ResourceMgr_GetAudioSoundFontIndex(fntList[i])] = str;
     }
 
+    ResourceMgr_LoadAudioSoundFontsAsync(fntList, fntListSize);
+    lusprintf(__FILE__, __LINE__, 2, "Indexed %d sequences and %d sound fonts in %lldus",
+              seqListSize + customSeqListSize, fntListSize, OS_CYCLES_TO_USEC(osGetTime() - bankLoadStart));
+
         numFonts = fntListSize;
 
         free(fntList);
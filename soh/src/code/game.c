@@ -470,7 +470,7 @@ void GameState_Destroy(GameState* gameState) {
     ResourceMgr_ClearSkeletons();
 
     if (ResourceMgr_IsAltAssetsEnabled()) {
-        ResourceUnloadDirectory("alt/*");
+        ResourceMgr_UnloadDirectory("alt/*");
         gfx_texture_cache_clear();
     }
 }
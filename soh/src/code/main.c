@@ -10,6 +10,7 @@
 
 #include <libultraship/bridge.h>
 #include "soh/CrashHandlerExp.h"
+#include "soh/Enhancements/randomizer/randomizer_batch.h"
 
 s32 gScreenWidth = SCREEN_WIDTH;
 s32 gScreenHeight = SCREEN_HEIGHT;
@@ -59,6 +60,10 @@ int main(int argc, char** argv)
 {
 #endif
 
+    if (RandomizerBatch_IsRequested(argc, argv)) {
+        return RandomizerBatch_Run(argc, argv);
+    }
+
     GameConsole_Init();
     InitOTR();
     // TODO: Was moved to below InitOTR because it requires window to be setup. But will be late to catch crashes.
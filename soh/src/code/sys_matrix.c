@@ -19,8 +19,15 @@ MtxF gMtxFClear = {
 };
 // clang-format on
 
-MtxF* sMatrixStack;   // "Matrix_stack"
-MtxF* sCurrentMatrix; // "Matrix_now"
+// Frame interpolation replays matrix ops on worker threads, so each thread gets its own stack
+#ifdef _MSC_VER
+#define MATRIX_THREAD_LOCAL __declspec(thread)
+#else
+#define MATRIX_THREAD_LOCAL _Thread_local
+#endif
+
+MATRIX_THREAD_LOCAL MtxF* sMatrixStack;   // "Matrix_stack"
+MATRIX_THREAD_LOCAL MtxF* sCurrentMatrix; // "Matrix_now"
 
 void Matrix_Init(GameState* gameState) {
     sCurrentMatrix = GAMESTATE_ALLOC_MC(gameState, 20 * sizeof(MtxF));
@@ -7,6 +7,7 @@
 #include "objects/gameplay_dangeon_keep/gameplay_dangeon_keep.h"
 #include "objects/object_bdoor/object_bdoor.h"
 #include "soh/frame_interpolation.h"
+#include "soh/cvar_handles.h"
 #include "soh/Enhancements/enemyrandomizer.h"
 #include "soh/Enhancements/game-interactor/GameInteractor.h"
 #include "soh/Enhancements/game-interactor/GameInteractor_Hooks.h"
@@ -353,37 +354,48 @@ void func_8002BE98(TargetContext* targetCtx, s32 actorCategory, PlayState* play)
     }
 }
 
+static CVarHandle sNaviColorChanged[] = {
+    CVAR_HANDLE(CVAR_COSMETIC("Navi.IdlePrimary.Changed"), 0),
+    CVAR_HANDLE(CVAR_COSMETIC("Navi.IdleSecondary.Changed"), 0),
+    CVAR_HANDLE(CVAR_COSMETIC("Navi.NPCPrimary.Changed"), 0),
+    CVAR_HANDLE(CVAR_COSMETIC("Navi.NPCSecondary.Changed"), 0),
+    CVAR_HANDLE(CVAR_COSMETIC("Navi.EnemyPrimary.Changed"), 0),
+    CVAR_HANDLE(CVAR_COSMETIC("Navi.EnemySecondary.Changed"), 0),
+    CVAR_HANDLE(CVAR_COSMETIC("Navi.PropsPrimary.Changed"), 0),
+    CVAR_HANDLE(CVAR_COSMETIC("Navi.PropsSecondary.Changed"), 0),
+};
+
 void func_8002BF60(TargetContext* targetCtx, Actor* actor, s32 actorCategory, PlayState* play) {
-    if (CVarGetInteger(CVAR_COSMETIC("Navi.IdlePrimary.Changed"), 0)) {
+    if (CVarHandle_GetInteger(&sNaviColorChanged[0])) {
         sNaviColorList[ACTORCAT_PLAYER].inner = CVarGetColor(CVAR_COSMETIC("Navi.IdlePrimary.Value"), defaultIdlePrimaryColor);
     } else {
         sNaviColorList[ACTORCAT_PLAYER].inner = defaultIdlePrimaryColor;
     }
-    if (CVarGetInteger(CVAR_COSMETIC("Navi.IdleSecondary.Changed"), 0)) {
+    if (CVarHandle_GetInteger(&sNaviColorChanged[1])) {
         sNaviColorList[ACTORCAT_PLAYER].outer = CVarGetColor(CVAR_COSMETIC("Navi.IdleSecondary.Value"), defaultIdleSecondaryColor);
     } else {
         sNaviColorList[ACTORCAT_PLAYER].outer = defaultIdleSecondaryColor;
     }
     
-    if (CVarGetInteger(CVAR_COSMETIC("Navi.NPCPrimary.Changed"), 0)) {
+    if (CVarHandle_GetInteger(&sNaviColorChanged[2])) {
         sNaviColorList[ACTORCAT_NPC].inner = CVarGetColor(CVAR_COSMETIC("Navi.NPCPrimary.Value"), defaultNPCPrimaryColor);
     } else {
         sNaviColorList[ACTORCAT_NPC].inner = defaultNPCPrimaryColor;
     }
-    if (CVarGetInteger(CVAR_COSMETIC("Navi.NPCSecondary.Changed"), 0)) {
+    if (CVarHandle_GetInteger(&sNaviColorChanged[3])) {
         sNaviColorList[ACTORCAT_NPC].outer = CVarGetColor(CVAR_COSMETIC("Navi.NPCSecondary.Value"), defaultNPCSecondaryColor);
     } else {
         sNaviColorList[ACTORCAT_NPC].outer = defaultNPCSecondaryColor;
     }
 
-    if (CVarGetInteger(CVAR_COSMETIC("Navi.EnemyPrimary.Changed"), 0)) {
+    if (CVarHandle_GetInteger(&sNaviColorChanged[4])) {
         sNaviColorList[ACTORCAT_ENEMY].inner = CVarGetColor(CVAR_COSMETIC("Navi.EnemyPrimary.Value"), defaultEnemyPrimaryColor);
         sNaviColorList[ACTORCAT_BOSS].inner = CVarGetColor(CVAR_COSMETIC("Navi.EnemyPrimary.Value"), defaultEnemyPrimaryColor);
     } else {
         sNaviColorList[ACTORCAT_ENEMY].inner = defaultEnemyPrimaryColor;
         sNaviColorList[ACTORCAT_BOSS].inner = defaultEnemyPrimaryColor;
     }
-    if (CVarGetInteger(CVAR_COSMETIC("Navi.EnemySecondary.Changed"), 0)) {
+    if (CVarHandle_GetInteger(&sNaviColorChanged[5])) {
         sNaviColorList[ACTORCAT_ENEMY].outer = CVarGetColor(CVAR_COSMETIC("Navi.EnemySecondary.Value"), defaultEnemySecondaryColor);
         sNaviColorList[ACTORCAT_BOSS].outer = CVarGetColor(CVAR_COSMETIC("Navi.EnemySecondary.Value"), defaultEnemySecondaryColor);
     } else {
@@ -391,12 +403,12 @@ void func_8002BF60(TargetContext* targetCtx, Actor* actor, s32 actorCategory, Pl
         sNaviColorList[ACTORCAT_BOSS].outer = defaultEnemySecondaryColor;
     }
 
-    if (CVarGetInteger(CVAR_COSMETIC("Navi.PropsPrimary.Changed"), 0)) {
+    if (CVarHandle_GetInteger(&sNaviColorChanged[6])) {
         sNaviColorList[ACTORCAT_PROP].inner = CVarGetColor(CVAR_COSMETIC("Navi.PropsPrimary.Value"), defaultPropsPrimaryColor);
     } else {
         sNaviColorList[ACTORCAT_PROP].inner = defaultPropsPrimaryColor;
     }
-    if (CVarGetInteger(CVAR_COSMETIC("Navi.PropsSecondary.Changed"), 0)) {
+    if (CVarHandle_GetInteger(&sNaviColorChanged[7])) {
         sNaviColorList[ACTORCAT_PROP].outer = CVarGetColor(CVAR_COSMETIC("Navi.PropsSecondary.Value"), defaultPropsSecondaryColor);
     } else {
         sNaviColorList[ACTORCAT_PROP].outer = defaultPropsSecondaryColor;
@@ -2902,6 +2914,12 @@ s32 func_800314D4(PlayState* play, Actor* actor, Vec3f* arg2, f32 arg3) {
     return false;
 }
 
+// Read for every actor every frame, so resolved once instead of looked up by name each time
+static CVarHandle sDisableDrawDistance = CVAR_HANDLE(CVAR_ENHANCEMENT("DisableDrawDistance"), 1);
+static CVarHandle sWidescreenActorCulling = CVAR_HANDLE(CVAR_ENHANCEMENT("WidescreenActorCulling"), 0);
+static CVarHandle sExtendedCullingExcludeGlitchActors =
+    CVAR_HANDLE(CVAR_ENHANCEMENT("ExtendedCullingExcludeGlitchActors"), 0);
+
 // #region SOH [Enhancements] Allows us to increase the draw and update distance independently,
 // mostly a modified version of the function above and additional tweaks for some specfic actors
 s32 Ship_CalcShouldDrawAndUpdate(PlayState* play, Actor* actor, Vec3f* projectedPos, f32 projectedW, bool* shouldDraw,
@@ -2920,7 +2938,7 @@ s32 Ship_CalcShouldDrawAndUpdate(PlayState* play, Actor* actor, Vec3f* projected
         return false;
     }
 
-    s32 multiplier = CVarGetInteger(CVAR_ENHANCEMENT("DisableDrawDistance"), 1);
+    s32 multiplier = CVarHandle_GetInteger(&sDisableDrawDistance);
     multiplier = MAX(multiplier, 1);
 
     // Some actors have a really short forward value, so we need to add to it before the multiplier to increase the
@@ -2933,7 +2951,7 @@ s32 Ship_CalcShouldDrawAndUpdate(PlayState* play, Actor* actor, Vec3f* projected
 
         f32 ratioAdjusted = 1.0f;
 
-        if (CVarGetInteger(CVAR_ENHANCEMENT("WidescreenActorCulling"), 0)) {
+        if (CVarHandle_GetInteger(&sWidescreenActorCulling)) {
             f32 originalAspectRatio = 4.0f / 3.0f;
             f32 currentAspectRatio = OTRGetAspectRatio();
             ratioAdjusted = MAX(currentAspectRatio / originalAspectRatio, 1.0f);
@@ -2943,7 +2961,7 @@ s32 Ship_CalcShouldDrawAndUpdate(PlayState* play, Actor* actor, Vec3f* projected
             (((projectedPos->y + actor->uncullZoneDownward) * clampedProjectedW) > -1.0f) &&
             (((projectedPos->y - actor->uncullZoneScale) * clampedProjectedW) < 1.0f)) {
 
-            if (CVarGetInteger(CVAR_ENHANCEMENT("ExtendedCullingExcludeGlitchActors"), 0)) {
+            if (CVarHandle_GetInteger(&sExtendedCullingExcludeGlitchActors)) {
                 // These actors are safe to draw without impacting glitches
                 if ((actor->id == ACTOR_OBJ_BOMBIWA || actor->id == ACTOR_OBJ_HAMISHI ||
                      actor->id == ACTOR_EN_ISHI) || // Boulders (hookshot through collision)
@@ -3015,8 +3033,8 @@ void func_800315AC(PlayState* play, ActorContext* actorCtx) {
             bool shipShouldDraw = false;
             bool shipShouldUpdate = false;
             if ((HREG(64) != 1) || ((HREG(65) != -1) && (HREG(65) != HREG(66))) || (HREG(70) == 0)) {
-                if (CVarGetInteger(CVAR_ENHANCEMENT("DisableDrawDistance"), 1) > 1 ||
-                    CVarGetInteger(CVAR_ENHANCEMENT("WidescreenActorCulling"), 0)) {
+                if (CVarHandle_GetInteger(&sDisableDrawDistance) > 1 ||
+                    CVarHandle_GetInteger(&sWidescreenActorCulling)) {
                     Ship_CalcShouldDrawAndUpdate(play, actor, &actor->projectedPos, actor->projectedW, &shipShouldDraw,
                                                  &shipShouldUpdate);
 
@@ -450,6 +450,151 @@ s32 CollisionPoly_SphVsPoly(CollisionPoly* poly, Vec3s* vtxList, Vec3f* center,
     return Math3D_TriVsSphIntersect(&sphere, &tri, &intersect);
 }
 
+/**
+ * Gets the smallest y of the vertices of static poly `polyId`
+ */
+static f32 BgCheck_GetStaticPolyMinY(CollisionContext* colCtx, s32 polyId) {
+    CollisionPoly* poly;
+    Vec3s* vtxList;
+
+    if (colCtx->polyCache != NULL) {
+        return colCtx->polyCache->minY[polyId];
+    }
+    poly = &colCtx->colHeader->polyList[polyId];
+    vtxList = colCtx->colHeader->vtxList;
+    return fminf(fminf(vtxList[COLPOLY_VTX_INDEX(poly->flags_vIA)].y, vtxList[COLPOLY_VTX_INDEX(poly->flags_vIB)].y),
+                 vtxList[poly->vIC].y);
+}
+
+/**
+ * Gets the vertices and unit normal of static poly `polyId`, from the poly cache if there is one
+ * `polyVerts` is only written to without the cache, use the returned pointer
+ */
+static Vec3f* BgCheck_GetStaticPolyVertices(CollisionContext* colCtx, s32 polyId, Vec3f* polyVerts,
+                                             Vec3f* normal) {
+    CollisionPoly* poly;
+
+    if (colCtx->polyCache != NULL) {
+        *normal = colCtx->polyCache->normal[polyId];
+        return &colCtx->polyCache->vtx[polyId * 3];
+    }
+    poly = &colCtx->colHeader->polyList[polyId];
+    CollisionPoly_GetVertices(poly, colCtx->colHeader->vtxList, polyVerts);
+    CollisionPoly_GetNormalF(poly, &normal->x, &normal->y, &normal->z);
+    return polyVerts;
+}
+
+/**
+ * Checks if point (`x`,`z`) is more than `chkDist` outside the xz bounds of static poly `polyId`, the first test
+ * Math3D_TriChkPointParaYImpl makes. Without the poly cache this always returns false and leaves it to that test.
+ */
+static s32 BgCheck_StaticPolyOutsideXZ(CollisionContext* colCtx, s32 polyId, f32 x, f32 z, f32 chkDist) {
+    StaticPolyCache* cache = colCtx->polyCache;
+
+    if (cache == NULL) {
+        return false;
+    }
+    return !((cache->minZ[polyId] - chkDist) <= z && (cache->maxZ[polyId] + chkDist) >= z &&
+             (cache->minX[polyId] - chkDist) <= x && (cache->maxX[polyId] + chkDist) >= x);
+}
+
+/**
+ * CollisionPoly_CheckYIntersect for static poly `polyId`
+ */
+static s32 BgCheck_StaticPolyCheckYIntersect(CollisionContext* colCtx, s32 polyId, f32 x, f32 z, f32* yIntersect,
+                                             f32 chkDist) {
+    Vec3f polyVerts[3];
+    Vec3f normal;
+    Vec3f* verts;
+
+    if (BgCheck_StaticPolyOutsideXZ(colCtx, polyId, x, z, chkDist)) {
+        return false;
+    }
+    verts = BgCheck_GetStaticPolyVertices(colCtx, polyId, polyVerts, &normal);
+    return Math3D_TriChkPointParaYIntersectInsideTri(&verts[0], &verts[1], &verts[2], normal.x, normal.y, normal.z,
+                                                     colCtx->colHeader->polyList[polyId].dist, z, x, yIntersect,
+                                                     chkDist);
+}
+
+/**
+ * CollisionPoly_CheckYIntersectApprox1 for static poly `polyId`
+ */
+static s32 BgCheck_StaticPolyCheckYIntersectApprox1(CollisionContext* colCtx, s32 polyId, f32 x, f32 z,
+                                                    f32* yIntersect, f32 chkDist) {
+    Vec3f polyVerts[3];
+    Vec3f normal;
+    Vec3f* verts;
+
+    if (BgCheck_StaticPolyOutsideXZ(colCtx, polyId, x, z, chkDist)) {
+        return false;
+    }
+    verts = BgCheck_GetStaticPolyVertices(colCtx, polyId, polyVerts, &normal);
+    return Math3D_TriChkPointParaYIntersectDist(&verts[0], &verts[1], &verts[2], normal.x, normal.y, normal.z,
+                                                colCtx->colHeader->polyList[polyId].dist, z, x, yIntersect, chkDist);
+}
+
+/**
+ * CollisionPoly_CheckXIntersectApprox for static poly `polyId`
+ */
+static s32 BgCheck_StaticPolyCheckXIntersectApprox(CollisionContext* colCtx, s32 polyId, f32 y, f32 z,
+                                                   f32* xIntersect) {
+    Vec3f polyVerts[3];
+    Vec3f normal;
+    Vec3f* verts = BgCheck_GetStaticPolyVertices(colCtx, polyId, polyVerts, &normal);
+
+    return Math3D_TriChkPointParaXIntersect(&verts[0], &verts[1], &verts[2], normal.x, normal.y, normal.z,
+                                            colCtx->colHeader->polyList[polyId].dist, y, z, xIntersect);
+}
+
+/**
+ * CollisionPoly_CheckZIntersectApprox for static poly `polyId`
+ */
+static s32 BgCheck_StaticPolyCheckZIntersectApprox(CollisionContext* colCtx, s32 polyId, f32 x, f32 y,
+                                                   f32* zIntersect) {
+    Vec3f polyVerts[3];
+    Vec3f normal;
+    Vec3f* verts = BgCheck_GetStaticPolyVertices(colCtx, polyId, polyVerts, &normal);
+
+    return Math3D_TriChkPointParaZIntersect(&verts[0], &verts[1], &verts[2], normal.x, normal.y, normal.z,
+                                            colCtx->colHeader->polyList[polyId].dist, x, y, zIntersect);
+}
+
+/**
+ * CollisionPoly_SphVsPoly for static poly `polyId`
+ */
+static s32 BgCheck_StaticPolySphVsPoly(CollisionContext* colCtx, s32 polyId, Vec3f* center, f32 radius) {
+    static Sphere16 sphere;
+    static TriNorm tri;
+    StaticPolyCache* cache = colCtx->polyCache;
+    Vec3f intersect;
+    Vec3f* verts;
+    f32 reach;
+
+    if (cache != NULL) {
+        // Math3D_TriVsSphIntersect starts with a box test on the truncated Sphere16, reject whatever that would with
+        // a unit of slack for the truncation
+        reach = fabsf(radius) + 1.0f;
+        if (center->x + reach < cache->minX[polyId] || center->x - reach > cache->maxX[polyId] ||
+            center->y + reach < cache->minY[polyId] || center->y - reach > cache->maxY[polyId] ||
+            center->z + reach < cache->minZ[polyId] || center->z - reach > cache->maxZ[polyId]) {
+            return false;
+        }
+    }
+
+    verts = BgCheck_GetStaticPolyVertices(colCtx, polyId, tri.vtx, &tri.plane.normal);
+    if (verts != tri.vtx) {
+        tri.vtx[0] = verts[0];
+        tri.vtx[1] = verts[1];
+        tri.vtx[2] = verts[2];
+    }
+    tri.plane.originDist = colCtx->colHeader->polyList[polyId].dist;
+    sphere.center.x = center->x;
+    sphere.center.y = center->y;
+    sphere.center.z = center->z;
+    sphere.radius = radius;
+    return Math3D_TriVsSphIntersect(&sphere, &tri, &intersect);
+}
+
 /**
  * Add poly to StaticLookup table
  * Table is sorted by poly's smallest y vertex component
@@ -554,14 +699,11 @@ f32 BgCheck_RaycastFloorStaticList(CollisionContext* colCtx, u16 xpFlags, SSList
             continue;
         }
 
-        if (pos->y < colCtx->colHeader->vtxList[COLPOLY_VTX_INDEX(colCtx->colHeader->polyList[polyId].flags_vIA)].y &&
-            pos->y < colCtx->colHeader->vtxList[COLPOLY_VTX_INDEX(colCtx->colHeader->polyList[polyId].flags_vIB)].y &&
-            pos->y < colCtx->colHeader->vtxList[colCtx->colHeader->polyList[polyId].vIC].y) {
+        if (pos->y < BgCheck_GetStaticPolyMinY(colCtx, polyId)) {
             break;
         }
 
-        if (CollisionPoly_CheckYIntersect(&colCtx->colHeader->polyList[polyId], colCtx->colHeader->vtxList, pos->x,
-                                          pos->z, &yIntersect, chkDist) == true) {
+        if (BgCheck_StaticPolyCheckYIntersect(colCtx, polyId, pos->x, pos->z, &yIntersect, chkDist) == true) {
             // if poly is closer to pos without going over
             if (yIntersect < pos->y && result < yIntersect) {
 
@@ -692,8 +834,7 @@ s32 BgCheck_SphVsStaticWall(StaticLookup* lookup, CollisionContext* colCtx, u16
     while (true) {
         polyId = curNode->polyId;
         curPoly = &polyList[polyId];
-        if (pos->y < vtxList[COLPOLY_VTX_INDEX(curPoly->flags_vIA)].y &&
-            pos->y < vtxList[COLPOLY_VTX_INDEX(curPoly->flags_vIB)].y && pos->y < vtxList[curPoly->vIC].y) {
+        if (pos->y < BgCheck_GetStaticPolyMinY(colCtx, polyId)) {
             break;
         }
 
@@ -725,20 +866,25 @@ s32 BgCheck_SphVsStaticWall(StaticLookup* lookup, CollisionContext* colCtx, u16
         }
 
         // compute curPoly zMin/zMax
-        zTemp = vtxList[COLPOLY_VTX_INDEX(curPoly->flags_vIA)].z;
-        zMax = zMin = zTemp;
-        zTemp = vtxList[COLPOLY_VTX_INDEX(curPoly->flags_vIB)].z;
-
-        if (zTemp < zMin) {
-            zMin = zTemp;
-        } else if (zMax < zTemp) {
-            zMax = zTemp;
-        }
-        zTemp = vtxList[curPoly->vIC].z;
-        if (zTemp < zMin) {
-            zMin = zTemp;
-        } else if (zTemp > zMax) {
-            zMax = zTemp;
+        if (colCtx->polyCache != NULL) {
+            zMin = colCtx->polyCache->minZ[polyId];
+            zMax = colCtx->polyCache->maxZ[polyId];
+        } else {
+            zTemp = vtxList[COLPOLY_VTX_INDEX(curPoly->flags_vIA)].z;
+            zMax = zMin = zTemp;
+            zTemp = vtxList[COLPOLY_VTX_INDEX(curPoly->flags_vIB)].z;
+
+            if (zTemp < zMin) {
+                zMin = zTemp;
+            } else if (zMax < zTemp) {
+                zMax = zTemp;
+            }
+            zTemp = vtxList[curPoly->vIC].z;
+            if (zTemp < zMin) {
+                zMin = zTemp;
+            } else if (zTemp > zMax) {
+                zMax = zTemp;
+            }
         }
 
         zMin -= radius;
@@ -752,7 +898,7 @@ s32 BgCheck_SphVsStaticWall(StaticLookup* lookup, CollisionContext* colCtx, u16
                 continue;
             }
         }
-        if (CollisionPoly_CheckZIntersectApprox(curPoly, vtxList, resultPos.x, pos->y, &intersect)) {
+        if (BgCheck_StaticPolyCheckZIntersectApprox(colCtx, polyId, resultPos.x, pos->y, &intersect)) {
             if (fabsf(intersect - resultPos.z) <= radius / temp_f16) {
                 if ((intersect - resultPos.z) * nz <= 4.0f) {
                     BgCheck_ComputeWallDisplacement(colCtx, curPoly, &resultPos.x, &resultPos.z, nx, ny, nz,
@@ -773,8 +919,7 @@ s32 BgCheck_SphVsStaticWall(StaticLookup* lookup, CollisionContext* colCtx, u16
     while (true) {
         polyId = curNode->polyId;
         curPoly = &polyList[polyId];
-        if (pos->y < vtxList[COLPOLY_VTX_INDEX(curPoly->flags_vIA)].y &&
-            pos->y < vtxList[COLPOLY_VTX_INDEX(curPoly->flags_vIB)].y && pos->y < vtxList[curPoly->vIC].y) {
+        if (pos->y < BgCheck_GetStaticPolyMinY(colCtx, polyId)) {
             break;
         }
 
@@ -806,20 +951,25 @@ s32 BgCheck_SphVsStaticWall(StaticLookup* lookup, CollisionContext* colCtx, u16
         }
 
         // compute curPoly xMin/xMax
-        xTemp = vtxList[COLPOLY_VTX_INDEX(curPoly->flags_vIA)].x;
-        xMax = xMin = xTemp;
-        xTemp = vtxList[COLPOLY_VTX_INDEX(curPoly->flags_vIB)].x;
-
-        if (xTemp < xMin) {
-            xMin = xTemp;
-        } else if (xMax < xTemp) {
-            xMax = xTemp;
-        }
-        xTemp = vtxList[curPoly->vIC].x;
-        if (xTemp < xMin) {
-            xMin = xTemp;
-        } else if (xMax < xTemp) {
-            xMax = xTemp;
+        if (colCtx->polyCache != NULL) {
+            xMin = colCtx->polyCache->minX[polyId];
+            xMax = colCtx->polyCache->maxX[polyId];
+        } else {
+            xTemp = vtxList[COLPOLY_VTX_INDEX(curPoly->flags_vIA)].x;
+            xMax = xMin = xTemp;
+            xTemp = vtxList[COLPOLY_VTX_INDEX(curPoly->flags_vIB)].x;
+
+            if (xTemp < xMin) {
+                xMin = xTemp;
+            } else if (xMax < xTemp) {
+                xMax = xTemp;
+            }
+            xTemp = vtxList[curPoly->vIC].x;
+            if (xTemp < xMin) {
+                xMin = xTemp;
+            } else if (xMax < xTemp) {
+                xMax = xTemp;
+            }
         }
 
         xMin -= radius;
@@ -833,7 +983,7 @@ s32 BgCheck_SphVsStaticWall(StaticLookup* lookup, CollisionContext* colCtx, u16
                 continue;
             }
         }
-        if (CollisionPoly_CheckXIntersectApprox(curPoly, vtxList, pos->y, resultPos.z, &intersect)) {
+        if (BgCheck_StaticPolyCheckXIntersectApprox(colCtx, polyId, pos->y, resultPos.z, &intersect)) {
             if (fabsf(intersect - resultPos.x) <= radius / temp_f16) {
                 if ((intersect - resultPos.x) * nx <= 4.0f) {
                     BgCheck_ComputeWallDisplacement(colCtx, curPoly, &resultPos.x, &resultPos.z, nx, ny, nz,
@@ -868,7 +1018,6 @@ s32 BgCheck_CheckStaticCeiling(StaticLookup* lookup, u16 xpFlags, CollisionConte
     CollisionPoly* curPoly;
     CollisionPoly* polyList;
     f32 ceilingY;
-    Vec3s* vtxList;
     SSNode* curNode;
     s32 curPolyId;
 
@@ -877,7 +1026,6 @@ s32 BgCheck_CheckStaticCeiling(StaticLookup* lookup, u16 xpFlags, CollisionConte
     }
     curNode = &colCtx->polyNodes.tbl[lookup->ceiling.head];
     polyList = colCtx->colHeader->polyList;
-    vtxList = colCtx->colHeader->vtxList;
 
     *outY = pos->y;
 
@@ -893,7 +1041,7 @@ s32 BgCheck_CheckStaticCeiling(StaticLookup* lookup, u16 xpFlags, CollisionConte
         }
         curPoly = &polyList[curPolyId];
 
-        if (CollisionPoly_CheckYIntersectApprox2(curPoly, vtxList, pos->x, pos->z, &ceilingY)) {
+        if (BgCheck_StaticPolyCheckYIntersectApprox1(colCtx, curPolyId, pos->x, pos->z, &ceilingY, 1.0f)) {
             f32 intersectDist = ceilingY - *outY;
             f32 ny = COLPOLY_GET_NORMAL(curPoly->normal.y);
 
@@ -1023,7 +1171,6 @@ s32 BgCheck_CheckLineInSubdivision(StaticLookup* lookup, CollisionContext* colCt
 s32 BgCheck_SphVsFirstStaticPolyList(SSNode* node, u16 xpFlags, CollisionContext* colCtx, Vec3f* center, f32 radius,
                                      CollisionPoly** outPoly) {
     CollisionPoly* polyList = colCtx->colHeader->polyList;
-    Vec3s* vtxList = colCtx->colHeader->vtxList;
     CollisionPoly* curPoly;
     u16 nextId;
     s16 curPolyId;
@@ -1040,13 +1187,11 @@ s32 BgCheck_SphVsFirstStaticPolyList(SSNode* node, u16 xpFlags, CollisionContext
             }
         }
 
-        if (center->y + radius < vtxList[COLPOLY_VTX_INDEX(curPoly->flags_vIA)].y &&
-            center->y + radius < vtxList[COLPOLY_VTX_INDEX(curPoly->flags_vIB)].y &&
-            center->y + radius < vtxList[curPoly->vIC].y) {
+        if (center->y + radius < BgCheck_GetStaticPolyMinY(colCtx, curPolyId)) {
             break;
         }
 
-        if (CollisionPoly_SphVsPoly(curPoly, vtxList, center, radius)) {
+        if (BgCheck_StaticPolySphVsPoly(colCtx, curPolyId, center, radius)) {
             *outPoly = curPoly;
             return true;
         }
@@ -1503,6 +1648,58 @@ typedef struct {
     s32 nodeListMax; // if -1, dynamically compute max nodes
 } BgCheckSceneSubdivisionEntry;
 
+/**
+ * Builds the static poly cache. Allocated from the game state like polyCheckTbl, and left NULL if that fails, in which
+ * case the static checks read the Vec3s vertex list the way they always have.
+ */
+static void BgCheck_InitStaticPolyCache(CollisionContext* colCtx, PlayState* play) {
+    CollisionHeader* colHeader = colCtx->colHeader;
+    StaticPolyCache* cache;
+    s32 numPolys = colHeader->numPolygons;
+    s32 polyId;
+    s32 i;
+
+    colCtx->polyCache = NULL;
+    cache = GAMESTATE_ALLOC_MC(&play->state,
+                               sizeof(StaticPolyCache) + numPolys * (6 * sizeof(f32) + 4 * sizeof(Vec3f)));
+    if (cache == NULL) {
+        osSyncPrintf("BgCheck_InitStaticPolyCache(): not enough memory for %d polys, not caching\n", numPolys);
+        return;
+    }
+
+    cache->numPolys = numPolys;
+    cache->normal = (Vec3f*)(cache + 1);
+    cache->vtx = cache->normal + numPolys;
+    cache->minX = (f32*)(cache->vtx + numPolys * 3);
+    cache->maxX = cache->minX + numPolys;
+    cache->minY = cache->maxX + numPolys;
+    cache->maxY = cache->minY + numPolys;
+    cache->minZ = cache->maxY + numPolys;
+    cache->maxZ = cache->minZ + numPolys;
+
+    for (polyId = 0; polyId < numPolys; polyId++) {
+        CollisionPoly* poly = &colHeader->polyList[polyId];
+        Vec3f* vtx = &cache->vtx[polyId * 3];
+
+        CollisionPoly_GetVertices(poly, colHeader->vtxList, vtx);
+        CollisionPoly_GetNormalF(poly, &cache->normal[polyId].x, &cache->normal[polyId].y, &cache->normal[polyId].z);
+
+        cache->minX[polyId] = cache->maxX[polyId] = vtx[0].x;
+        cache->minY[polyId] = cache->maxY[polyId] = vtx[0].y;
+        cache->minZ[polyId] = cache->maxZ[polyId] = vtx[0].z;
+        for (i = 1; i < 3; i++) {
+            cache->minX[polyId] = fminf(cache->minX[polyId], vtx[i].x);
+            cache->maxX[polyId] = fmaxf(cache->maxX[polyId], vtx[i].x);
+            cache->minY[polyId] = fminf(cache->minY[polyId], vtx[i].y);
+            cache->maxY[polyId] = fmaxf(cache->maxY[polyId], vtx[i].y);
+            cache->minZ[polyId] = fminf(cache->minZ[polyId], vtx[i].z);
+            cache->maxZ[polyId] = fmaxf(cache->maxZ[polyId], vtx[i].z);
+        }
+    }
+
+    colCtx->polyCache = cache;
+}
+
 /**
  * Allocate CollisionContext
  */
@@ -1632,6 +1829,7 @@ void BgCheck_Allocate(CollisionContext* colCtx, PlayState* play, CollisionHeader
     SSNodeList_Alloc(play, &colCtx->polyNodes, tblMax, colCtx->colHeader->numPolygons);
 
     lookupTblMemSize = BgCheck_InitializeStaticLookup(colCtx, play, colCtx->lookupTbl);
+    BgCheck_InitStaticPolyCache(colCtx, play);
     osSyncPrintf(VT_FGCOL(GREEN));
     osSyncPrintf("/*---結局 BG使用サイズ %dbyte---*/\n", memSize + lookupTblMemSize);
     osSyncPrintf(VT_RST);
@@ -3,6 +3,8 @@
 #include "overlays/effects/ovl_Effect_Ss_HitMark/z_eff_ss_hitmark.h"
 #include "soh/Enhancements/game-interactor/GameInteractor.h"
 #include <assert.h>
+#include <float.h>
+#include <string.h>
 
 typedef s32 (*ColChkResetFunc)(PlayState*, Collider*);
 typedef void (*ColChkBloodFunc)(PlayState*, Collider*, Vec3f*);
@@ -2627,25 +2629,209 @@ static ColChkVsFunc sACVsFuncs[4][4] = {
 };
 
 /**
- * Iterates through all AC colliders, performing AC collisions with the AT collider.
+ * Broadphase for the AT/AC and OC checks. Each collider gets a world space bounding box, the boxes are sorted and swept
+ * along x, and every pair whose boxes overlap sets a bit in a pair table. The table has a row per collider and a bit
+ * per collider it might touch, so walking it row by row visits candidate pairs in the same order as testing every pair
+ * would. The shape checks only ever report hits between colliders that overlap, so skipping the rest changes nothing.
  */
-void CollisionCheck_AC(PlayState* play, CollisionCheckContext* colChkCtx, Collider* colAT) {
-    Collider** col;
+typedef struct {
+    Vec3f min;
+    Vec3f max;
+    s16 index; // Index in colAT, colAC or colOC
+    u8 list;   // Which list the collider came from when sweeping two lists against each other
+} ColChkBounds;
 
-    for (col = colChkCtx->colAC; col < colChkCtx->colAC + colChkCtx->colACCount; col++) {
-        Collider* colAC = *col;
+// Padding added to every bounding box so that colliders that only just touch, or that the shape checks consider
+// touching through rounding, are never culled
+#define COLCHK_BOUNDS_MARGIN 1.0f
 
-        if (colAC != NULL && colAC->acFlags & AC_ON) {
-            if (colAC->actor != NULL && colAC->actor->update == NULL) {
-                continue;
+#define COLCHK_PAIR_ROW_WORDS(count) (((count) + 31) / 32)
+#define COLCHK_SWEEP_MAX                                                                 \
+    ((COLLISION_CHECK_AT_MAX + COLLISION_CHECK_AC_MAX) > COLLISION_CHECK_OC_MAX          \
+         ? (COLLISION_CHECK_AT_MAX + COLLISION_CHECK_AC_MAX)                             \
+         : COLLISION_CHECK_OC_MAX)
+
+static ColChkBounds sColChkBounds[COLCHK_SWEEP_MAX];
+static u32 sATvsACPairs[COLLISION_CHECK_AT_MAX][COLCHK_PAIR_ROW_WORDS(COLLISION_CHECK_AC_MAX)];
+static u32 sOCvsOCPairs[COLLISION_CHECK_OC_MAX][COLCHK_PAIR_ROW_WORDS(COLLISION_CHECK_OC_MAX)];
+
+static void CollisionCheck_BoundsAddSphere(ColChkBounds* bounds, f32 x, f32 y, f32 z, f32 radius) {
+    if (x - radius < bounds->min.x) {
+        bounds->min.x = x - radius;
+    }
+    if (y - radius < bounds->min.y) {
+        bounds->min.y = y - radius;
+    }
+    if (z - radius < bounds->min.z) {
+        bounds->min.z = z - radius;
+    }
+    if (x + radius > bounds->max.x) {
+        bounds->max.x = x + radius;
+    }
+    if (y + radius > bounds->max.y) {
+        bounds->max.y = y + radius;
+    }
+    if (z + radius > bounds->max.z) {
+        bounds->max.z = z + radius;
+    }
+}
+
+/**
+ * Computes a box containing every element of the collider. Colliders without elements get an empty box, and shapes
+ * that can't be bounded get an infinite one so they're still tested against everything.
+ */
+static void CollisionCheck_GetBounds(Collider* collider, ColChkBounds* bounds) {
+    bounds->min.x = bounds->min.y = bounds->min.z = FLT_MAX;
+    bounds->max.x = bounds->max.y = bounds->max.z = -FLT_MAX;
+
+    switch (collider->shape) {
+        case COLSHAPE_JNTSPH: {
+            ColliderJntSph* jntSph = (ColliderJntSph*)collider;
+            ColliderJntSphElement* element;
+
+            if (jntSph->elements == NULL) {
+                break;
             }
-            if ((colAC->acFlags & colAT->atFlags & AC_TYPE_ALL) && (colAT != colAC)) {
-                if (!(colAT->atFlags & AT_SELF) && colAT->actor != NULL && colAC->actor == colAT->actor) {
-                    continue;
+            for (element = jntSph->elements; element < jntSph->elements + jntSph->count; element++) {
+                Sphere16* sphere = &element->dim.worldSphere;
+
+                CollisionCheck_BoundsAddSphere(bounds, sphere->center.x, sphere->center.y, sphere->center.z,
+                                               ABS((f32)sphere->radius));
+            }
+            break;
+        }
+        case COLSHAPE_CYLINDER: {
+            Cylinder16* cyl = &((ColliderCylinder*)collider)->dim;
+            f32 bottom = (f32)cyl->pos.y + cyl->yShift;
+            f32 radius = ABS((f32)cyl->radius);
+
+            CollisionCheck_BoundsAddSphere(bounds, cyl->pos.x, bottom, cyl->pos.z, radius);
+            CollisionCheck_BoundsAddSphere(bounds, cyl->pos.x, bottom + cyl->height, cyl->pos.z, radius);
+            break;
+        }
+        case COLSHAPE_TRIS: {
+            ColliderTris* tris = (ColliderTris*)collider;
+            ColliderTrisElement* element;
+            s32 i;
+
+            if (tris->elements == NULL) {
+                break;
+            }
+            for (element = tris->elements; element < tris->elements + tris->count; element++) {
+                for (i = 0; i < ARRAY_COUNT(element->dim.vtx); i++) {
+                    Vec3f* vtx = &element->dim.vtx[i];
+
+                    CollisionCheck_BoundsAddSphere(bounds, vtx->x, vtx->y, vtx->z, 0.0f);
                 }
-                sACVsFuncs[colAT->shape][colAC->shape](play, colChkCtx, colAT, colAC);
             }
+            break;
+        }
+        case COLSHAPE_QUAD: {
+            ColliderQuad* quad = (ColliderQuad*)collider;
+            s32 i;
+
+            for (i = 0; i < ARRAY_COUNT(quad->dim.quad); i++) {
+                Vec3f* vtx = &quad->dim.quad[i];
+
+                CollisionCheck_BoundsAddSphere(bounds, vtx->x, vtx->y, vtx->z, 0.0f);
+            }
+            break;
+        }
+        default:
+            bounds->min.x = bounds->min.y = bounds->min.z = -FLT_MAX;
+            bounds->max.x = bounds->max.y = bounds->max.z = FLT_MAX;
+            return;
+    }
+
+    if (bounds->min.x <= bounds->max.x) {
+        bounds->min.x -= COLCHK_BOUNDS_MARGIN;
+        bounds->min.y -= COLCHK_BOUNDS_MARGIN;
+        bounds->min.z -= COLCHK_BOUNDS_MARGIN;
+        bounds->max.x += COLCHK_BOUNDS_MARGIN;
+        bounds->max.y += COLCHK_BOUNDS_MARGIN;
+        bounds->max.z += COLCHK_BOUNDS_MARGIN;
+    }
+}
+
+/**
+ * Sorts the bounds by their lowest x and sweeps through them, keeping a list of the boxes the sweep is still inside.
+ * Every overlapping pair sets a bit in `pairs`. With `singleList`, all pairs are set in the row of the lower index.
+ * Otherwise only pairs from different lists are set, in the row of the list 0 entry.
+ */
+static void CollisionCheck_SweepBounds(ColChkBounds* bounds, s32 count, s32 singleList, u32* pairs, s32 rowWords) {
+    static ColChkBounds* sorted[COLCHK_SWEEP_MAX];
+    static ColChkBounds* active[COLCHK_SWEEP_MAX];
+    s32 activeCount = 0;
+    s32 i;
+    s32 j;
+
+    // The lists are small and built in actor order, so an insertion sort does fine here
+    for (i = 0; i < count; i++) {
+        for (j = i; j > 0 && sorted[j - 1]->min.x > bounds[i].min.x; j--) {
+            sorted[j] = sorted[j - 1];
+        }
+        sorted[j] = &bounds[i];
+    }
+
+    for (i = 0; i < count; i++) {
+        ColChkBounds* entry = sorted[i];
+
+        for (j = 0; j < activeCount;) {
+            ColChkBounds* other = active[j];
+            s32 row;
+            s32 column;
+
+            if (other->max.x < entry->min.x) {
+                // The sweep has passed this box, nothing later can overlap it
+                active[j] = active[--activeCount];
+                continue;
+            }
+            j++;
+
+            if ((!singleList && other->list == entry->list) || other->max.y < entry->min.y ||
+                entry->max.y < other->min.y || other->max.z < entry->min.z || entry->max.z < other->min.z) {
+                continue;
+            }
+
+            if (singleList ? entry->index < other->index : entry->list == 0) {
+                row = entry->index;
+                column = other->index;
+            } else {
+                row = other->index;
+                column = entry->index;
+            }
+            pairs[row * rowWords + column / 32] |= 1u << (column % 32);
         }
+        active[activeCount++] = entry;
+    }
+}
+
+/**
+ * Performs AC collisions between an AT collider and an AC collider, if they're able to collide.
+ */
+void CollisionCheck_ACPair(PlayState* play, CollisionCheckContext* colChkCtx, Collider* colAT, Collider* colAC) {
+    if (colAC != NULL && colAC->acFlags & AC_ON) {
+        if (colAC->actor != NULL && colAC->actor->update == NULL) {
+            return;
+        }
+        if ((colAC->acFlags & colAT->atFlags & AC_TYPE_ALL) && (colAT != colAC)) {
+            if (!(colAT->atFlags & AT_SELF) && colAT->actor != NULL && colAC->actor == colAT->actor) {
+                return;
+            }
+            sACVsFuncs[colAT->shape][colAC->shape](play, colChkCtx, colAT, colAC);
+        }
+    }
+}
+
+/**
+ * Iterates through all AC colliders, performing AC collisions with the AT collider. CollisionCheck_AT now only tests
+ * pairs found by the broadphase, this is the exhaustive version.
+ */
+void CollisionCheck_AC(PlayState* play, CollisionCheckContext* colChkCtx, Collider* colAT) {
+    Collider** col;
+
+    for (col = colChkCtx->colAC; col < colChkCtx->colAC + colChkCtx->colACCount; col++) {
+        CollisionCheck_ACPair(play, colChkCtx, colAT, *col);
     }
 }
 
@@ -2656,19 +2842,55 @@ void CollisionCheck_AC(PlayState* play, CollisionCheckContext* colChkCtx, Collid
  * with the AC collider and the toucher and bumper elements that overlapped must share a dmgFlag.
  */
 void CollisionCheck_AT(PlayState* play, CollisionCheckContext* colChkCtx) {
-    Collider** col;
+    s32 boundsCount = 0;
+    s32 i;
+    s32 word;
 
     if (colChkCtx->colATCount == 0 || colChkCtx->colACCount == 0) {
         return;
     }
-    for (col = colChkCtx->colAT; col < colChkCtx->colAT + colChkCtx->colATCount; col++) {
-        Collider* colAT = *col;
+
+    for (i = 0; i < colChkCtx->colATCount; i++) {
+        Collider* colAT = colChkCtx->colAT[i];
 
         if (colAT != NULL && colAT->atFlags & AT_ON) {
             if (colAT->actor != NULL && colAT->actor->update == NULL) {
                 continue;
             }
-            CollisionCheck_AC(play, colChkCtx, colAT);
+            CollisionCheck_GetBounds(colAT, &sColChkBounds[boundsCount]);
+            sColChkBounds[boundsCount].index = i;
+            sColChkBounds[boundsCount].list = 0;
+            boundsCount++;
+        }
+    }
+    for (i = 0; i < colChkCtx->colACCount; i++) {
+        Collider* colAC = colChkCtx->colAC[i];
+
+        if (colAC != NULL && colAC->acFlags & AC_ON) {
+            if (colAC->actor != NULL && colAC->actor->update == NULL) {
+                continue;
+            }
+            CollisionCheck_GetBounds(colAC, &sColChkBounds[boundsCount]);
+            sColChkBounds[boundsCount].index = i;
+            sColChkBounds[boundsCount].list = 1;
+            boundsCount++;
+        }
+    }
+
+    memset(sATvsACPairs, 0, colChkCtx->colATCount * sizeof(sATvsACPairs[0]));
+    CollisionCheck_SweepBounds(sColChkBounds, boundsCount, false, &sATvsACPairs[0][0],
+                               ARRAY_COUNT(sATvsACPairs[0]));
+
+    for (i = 0; i < colChkCtx->colATCount; i++) {
+        for (word = 0; word < ARRAY_COUNT(sATvsACPairs[i]); word++) {
+            u32 bits = sATvsACPairs[i][word];
+            s32 j;
+
+            for (j = word * 32; bits != 0; j++, bits >>= 1) {
+                if (bits & 1) {
+                    CollisionCheck_ACPair(play, colChkCtx, colChkCtx->colAT[i], colChkCtx->colAC[j]);
+                }
+            }
         }
     }
     CollisionCheck_SetHitEffects(play, colChkCtx);
@@ -2923,23 +3145,41 @@ void CollisionCheck_OC(PlayState* play, CollisionCheckContext* colChkCtx) {
     Collider** left;
     Collider** right;
     ColChkVsFunc vsFunc;
+    s32 boundsCount = 0;
+    s32 i;
+    s32 word;
 
-    for (left = colChkCtx->colOC; left < colChkCtx->colOC + colChkCtx->colOCCount; left++) {
-        if (*left == NULL || CollisionCheck_SkipOC(*left) == 1) {
+    // Only pairs whose bounds overlap are tested, see CollisionCheck_SweepBounds
+    for (i = 0; i < colChkCtx->colOCCount; i++) {
+        if (colChkCtx->colOC[i] == NULL || CollisionCheck_SkipOC(colChkCtx->colOC[i]) == 1) {
             continue;
         }
-        for (right = left + 1; right < colChkCtx->colOC + colChkCtx->colOCCount; right++) {
-            if (*right == NULL || CollisionCheck_SkipOC(*right) == 1 ||
-                CollisionCheck_Incompatible(*left, *right) == 1) {
-                continue;
-            }
-            vsFunc = sOCVsFuncs[(*left)->shape][(*right)->shape];
-            if (vsFunc == NULL) {
-                // "Not compatible"
-                osSyncPrintf("CollisionCheck_OC():未対応 %d, %d\n", (*left)->shape, (*right)->shape);
-                continue;
+        CollisionCheck_GetBounds(colChkCtx->colOC[i], &sColChkBounds[boundsCount]);
+        sColChkBounds[boundsCount].index = i;
+        sColChkBounds[boundsCount].list = 0;
+        boundsCount++;
+    }
+
+    memset(sOCvsOCPairs, 0, colChkCtx->colOCCount * sizeof(sOCvsOCPairs[0]));
+    CollisionCheck_SweepBounds(sColChkBounds, boundsCount, true, &sOCvsOCPairs[0][0], ARRAY_COUNT(sOCvsOCPairs[0]));
+
+    for (i = 0; i < colChkCtx->colOCCount; i++) {
+        left = &colChkCtx->colOC[i];
+        for (word = 0; word < ARRAY_COUNT(sOCvsOCPairs[i]); word++) {
+            u32 bits = sOCvsOCPairs[i][word];
+
+            for (right = &colChkCtx->colOC[word * 32]; bits != 0; right++, bits >>= 1) {
+                if (!(bits & 1) || CollisionCheck_Incompatible(*left, *right) == 1) {
+                    continue;
+                }
+                vsFunc = sOCVsFuncs[(*left)->shape][(*right)->shape];
+                if (vsFunc == NULL) {
+                    // "Not compatible"
+                    osSyncPrintf("CollisionCheck_OC():未対応 %d, %d\n", (*left)->shape, (*right)->shape);
+                    continue;
+                }
+                vsFunc(play, colChkCtx, *left, *right);
             }
-            vsFunc(play, colChkCtx, *left, *right);
         }
     }
 }